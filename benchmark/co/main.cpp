@@ -0,0 +1,351 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include "src/test/test.h"
+
+// 统计进程内所有的堆内存申请次数
+namespace
+{
+std::atomic_size_t g_alloc_count = 0;
+}
+
+void* operator new(const std::size_t size)
+{
+  g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace aimrte::bench
+{
+namespace
+{
+aimrt::co::Task<int> RawLeaf(const int x)
+{
+  co_return x + 1;
+}
+
+aimrt::co::Task<int> RawRoot(const int x)
+{
+  co_return co_await RawLeaf(x);
+}
+
+co::Task<int> PooledLeaf(const int x)
+{
+  co_return x + 1;
+}
+
+co::Task<int> PooledRoot(const int x)
+{
+  co_return co_await PooledLeaf(x);
+}
+}  // namespace
+
+// 在原地创建并同步执行两层协程，统计平均每个协程的堆内存申请次数。
+// 参数 0 为 AimRT 原生协程（协程帧直接由全局堆申请），参数 1 为池化协程帧的 co::Task
+static void CoroutineFrameAllocation(benchmark::State& st)
+{
+  constexpr std::size_t kBatch = 1000;
+
+  const bool pooled       = st.range(0) == 1;
+  std::size_t allocations = 0;
+  int sum                 = 0;
+
+  for (auto _ : st) {
+    const std::size_t begin = g_alloc_count.load();
+
+    for (std::size_t i = 0; i < kBatch; ++i) {
+      if (pooled)
+        sum += PooledRoot(static_cast<int>(i)).Sync();
+      else
+        sum += aimrt::co::SyncWait(RawRoot(static_cast<int>(i))).value();
+    }
+
+    allocations += g_alloc_count.load() - begin;
+  }
+
+  benchmark::DoNotOptimize(sum);
+  st.SetItemsProcessed(st.iterations() * kBatch * 2);
+  st.counters["allocs_per_task"] = static_cast<double>(allocations) / static_cast<double>(st.iterations() * kBatch * 2);
+}
+
+BENCHMARK(CoroutineFrameAllocation)->ArgName("pooled")->Arg(0)->Arg(1)->MinTime(2);
+
+class PostBench : public benchmark::Fixture
+{
+ public:
+  void SetUp(const benchmark::State&) override
+  {
+    aimrte::trait::renew(ctrl_);
+    ctrl_.SetConfigContent(
+      R"(
+aimrt:
+  configurator:
+    temp_cfg_path: ./cfg/tmp # 生成的临时模块配置文件存放路径
+  log: # log配置
+    core_lvl: Warn
+    default_module_lvl: Warn
+    backends: # 日志backends
+      - type: console # 控制台日志
+  executor:
+    executors:
+      - name: post_executor
+        type: asio_thread
+        options:
+          thread_num: 1
+)"
+    );
+
+    ctrl_.LetInit();
+    exe_ = ctx::init::Executor("post_executor");
+    ctrl_.LetStart();
+  }
+
+  void TearDown(const benchmark::State&) override
+  {
+    ctrl_.LetEnd();
+  }
+
+ protected:
+  void PostBatch(const std::size_t n)
+  {
+    for (std::size_t i = 0; i < n; ++i)
+      exe_.Post([this]() -> co::Task<void> {
+        done_.fetch_add(1, std::memory_order_relaxed);
+        co_return;
+      });
+  }
+
+  void WaitDone(const std::size_t expected) const
+  {
+    while (done_.load(std::memory_order_relaxed) < expected)
+      std::this_thread::yield();
+  }
+
+ protected:
+  test::ModuleTestController ctrl_;
+  ctx::Executor exe_;
+  std::atomic_size_t done_ = 0;
+};
+
+// 向执行器投递协程，统计投递与执行的吞吐量，以及平均每个任务的堆内存申请次数
+BENCHMARK_DEFINE_F(PostBench, PostedTaskThroughput)(benchmark::State& st)
+{
+  constexpr std::size_t kBatch = 1000;
+
+  // 预热，使内存池进入稳定状态
+  PostBatch(kBatch);
+  WaitDone(kBatch);
+
+  std::size_t posted      = kBatch;
+  std::size_t allocations = 0;
+
+  for (auto _ : st) {
+    const std::size_t begin = g_alloc_count.load();
+
+    PostBatch(kBatch);
+    posted += kBatch;
+    WaitDone(posted);
+
+    allocations += g_alloc_count.load() - begin;
+  }
+
+  st.SetItemsProcessed(st.iterations() * kBatch);
+  st.counters["allocs_per_task"] = static_cast<double>(allocations) / static_cast<double>(st.iterations() * kBatch);
+}
+
+BENCHMARK_REGISTER_F(PostBench, PostedTaskThroughput)->MinTime(2);
+
+// 在执行器上的协程中，反复 co_await 子协程，统计每次挂起与唤醒（携带上下文信息）的耗时
+BENCHMARK_DEFINE_F(PostBench, AwaitRoundTrip)(benchmark::State& st)
+{
+  constexpr std::size_t kBatch = 10000;
+
+  std::size_t expected = 0;
+
+  for (auto _ : st) {
+    exe_.Post([this]() -> co::Task<void> {
+      int sum = 0;
+      for (std::size_t i = 0; i < kBatch; ++i)
+        sum += co_await PooledLeaf(static_cast<int>(i));
+
+      benchmark::DoNotOptimize(sum);
+      done_.fetch_add(1, std::memory_order_relaxed);
+    });
+
+    WaitDone(++expected);
+  }
+
+  st.SetItemsProcessed(st.iterations() * kBatch);
+}
+
+BENCHMARK_REGISTER_F(PostBench, AwaitRoundTrip)->MinTime(2);
+
+class SleepBench : public benchmark::Fixture
+{
+ public:
+  void SetUp(const benchmark::State&) override
+  {
+    core::EnableTimerWheel("wheel_executor", std::chrono::milliseconds(1));
+
+    aimrte::trait::renew(ctrl_);
+    ctrl_.SetConfigContent(
+      R"(
+aimrt:
+  configurator:
+    temp_cfg_path: ./cfg/tmp # 生成的临时模块配置文件存放路径
+  log: # log配置
+    core_lvl: Warn
+    default_module_lvl: Warn
+    backends: # 日志backends
+      - type: console # 控制台日志
+  executor:
+    executors:
+      - name: plain_executor
+        type: asio_thread
+        options:
+          thread_num: 1
+      - name: wheel_executor
+        type: asio_thread
+        options:
+          thread_num: 1
+)"
+    );
+
+    ctrl_.LetInit();
+    plain_exe_ = ctx::init::Executor("plain_executor");
+    wheel_exe_ = ctx::init::Executor("wheel_executor");
+    ctrl_.LetStart();
+  }
+
+  void TearDown(const benchmark::State&) override
+  {
+    ctrl_.LetEnd();
+  }
+
+ protected:
+  test::ModuleTestController ctrl_;
+  ctx::Executor plain_exe_;
+  ctx::Executor wheel_exe_;
+  std::atomic_size_t done_ = 0;
+};
+
+// 一万个协程同时在执行器上以 1ms 为周期睡眠若干次，统计全部完成的耗时。
+// 参数 0 为逐个向执行器申请定时任务，参数 1 为使用时间轮批量唤醒
+BENCHMARK_DEFINE_F(SleepBench, ConcurrentSleepers)(benchmark::State& st)
+{
+  constexpr std::size_t kSleepers = 10000;
+  constexpr int kRounds           = 5;
+
+  const ctx::Executor& exe = st.range(0) == 1 ? wheel_exe_ : plain_exe_;
+  std::size_t expected     = 0;
+
+  for (auto _ : st) {
+    for (std::size_t i = 0; i < kSleepers; ++i)
+      exe.Post([this]() -> co::Task<void> {
+        for (int round = 0; round < kRounds; ++round)
+          co_await ctx::Sleep(std::chrono::milliseconds(1));
+
+        done_.fetch_add(1, std::memory_order_relaxed);
+      });
+
+    expected += kSleepers;
+    while (done_.load(std::memory_order_relaxed) < expected)
+      std::this_thread::sleep_for(std::chrono::microseconds(100));
+  }
+
+  st.SetItemsProcessed(st.iterations() * kSleepers * kRounds);
+}
+
+BENCHMARK_REGISTER_F(SleepBench, ConcurrentSleepers)->ArgName("wheel")->Arg(0)->Arg(1)->UseRealTime()->MinTime(2);
+
+class FanOutBench : public benchmark::Fixture
+{
+ public:
+  void SetUp(const benchmark::State&) override
+  {
+    aimrte::trait::renew(ctrl_);
+    ctrl_.SetConfigContent(
+      R"(
+aimrt:
+  configurator:
+    temp_cfg_path: ./cfg/tmp # 生成的临时模块配置文件存放路径
+  log: # log配置
+    core_lvl: Warn
+    default_module_lvl: Warn
+    backends: # 日志backends
+      - type: console # 控制台日志
+  executor:
+    executors:
+      - name: asio_executor
+        type: asio_thread
+        options:
+          thread_num: 4
+      - name: stealing_executor
+        type: work_stealing
+        options:
+          thread_num: 4
+)"
+    );
+
+    ctrl_.LetInit();
+    asio_exe_     = ctx::init::Executor("asio_executor");
+    stealing_exe_ = ctx::init::Executor("stealing_executor");
+    ctrl_.LetStart();
+  }
+
+  void TearDown(const benchmark::State&) override
+  {
+    ctrl_.LetEnd();
+  }
+
+ protected:
+  test::ModuleTestController ctrl_;
+  ctx::Executor asio_exe_;
+  ctx::Executor stealing_exe_;
+  std::atomic_size_t done_ = 0;
+};
+
+// 在执行器内扇出大量细粒度协程，每个协程让出一次后结束，统计全部完成的吞吐量。
+// 参数 0 为 asio_thread 执行器，参数 1 为 work_stealing 执行器
+BENCHMARK_DEFINE_F(FanOutBench, FanOut)(benchmark::State& st)
+{
+  constexpr std::size_t kTasks = 10000;
+
+  const ctx::Executor& exe = st.range(0) == 1 ? stealing_exe_ : asio_exe_;
+  std::size_t expected     = 0;
+
+  for (auto _ : st) {
+    exe.Post([this]() {
+      for (std::size_t i = 0; i < kTasks; ++i)
+        ctx::exe().Post([this]() -> co::Task<void> {
+          co_await ctx::Yield();
+          done_.fetch_add(1, std::memory_order_relaxed);
+        });
+    });
+
+    expected += kTasks;
+    while (done_.load(std::memory_order_relaxed) < expected)
+      std::this_thread::yield();
+  }
+
+  st.SetItemsProcessed(st.iterations() * kTasks);
+}
+
+BENCHMARK_REGISTER_F(FanOutBench, FanOut)->ArgName("stealing")->Arg(0)->Arg(1)->UseRealTime()->MinTime(2);
+}  // namespace aimrte::bench
+
+BENCHMARK_MAIN();
@@ -0,0 +1,133 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include <benchmark/benchmark.h>
+#include "src/test/test.h"
+#include "src/test_protocol/test_msg_new.pb.h"
+
+
+// 用户类型（std::string）到协议类型的转换，右值版本将直接移走数据
+namespace aimrte::impl
+{
+template <>
+void Convert(const std::string& src, test_protocol::TestMsg& dst)
+{
+  *dst.mutable_str() = src;
+}
+
+template <>
+void ConvertMoved(std::string&& src, test_protocol::TestMsg& dst)
+{
+  *dst.mutable_str() = std::move(src);
+}
+}  // namespace aimrte::impl
+
+namespace aimrte::bench
+{
+class PubBench : public benchmark::Fixture
+{
+ public:
+  void SetUp(const benchmark::State&) override
+  {
+    aimrte::trait::renew(ctrl_);
+    ctrl_.SetConfigContent(
+      R"(
+aimrt:
+  configurator:
+    temp_cfg_path: ./cfg/tmp # 生成的临时模块配置文件存放路径
+  log: # log配置
+    core_lvl: Warn
+    default_module_lvl: Warn
+    backends: # 日志backends
+      - type: console # 控制台日志
+  channel: # 消息队列相关配置
+    backends: # 消息队列后端配置
+      - type: local # 本地消息队列配置
+        options:
+          subscriber_use_inline_executor: true
+)"
+    );
+
+    ctrl_.LetInit();
+
+    // 同一话题，分别以原始资源标识符与绑定了句柄的发布器两种方式发布
+    pub_ = ctx::init::Publisher<test_protocol::TestMsg>("/bench/pub");
+    ch_  = pub_;
+
+    cvt_pub_       = ctx::init::Publisher<std::string, convert::By<test_protocol::TestMsg>>("/bench/pub_cvt");
+    cvt_reuse_pub_ = ctx::init::Publisher<std::string, convert::By<test_protocol::TestMsg>>("/bench/pub_cvt_reuse", {.reuse_buffer = true});
+
+    ctrl_.LetStart();
+    msg_.set_str("hello world");
+  }
+
+  void TearDown(const benchmark::State&) override
+  {
+    ctrl_.LetEnd();
+  }
+
+ protected:
+  test::ModuleTestController ctrl_;
+  ctx::Publisher<test_protocol::TestMsg> pub_;
+  res::Channel<test_protocol::TestMsg> ch_;
+  ctx::Publisher<std::string> cvt_pub_;
+  ctx::Publisher<std::string> cvt_reuse_pub_;
+  test_protocol::TestMsg msg_;
+};
+
+// 原有路径：每次发布都查找信道上下文，并通过擦除了类型的 std::function 发布
+BENCHMARK_DEFINE_F(PubBench, ContextLookup)(benchmark::State& st)
+{
+  for (auto _ : st) {
+    ctx::Publish(ch_, msg_);
+  }
+}
+
+// 快速路径：通过初始化时绑定的发布句柄，直接调用原生发布函数
+BENCHMARK_DEFINE_F(PubBench, BoundHandle)(benchmark::State& st)
+{
+  for (auto _ : st) {
+    pub_.Publish(msg_);
+  }
+}
+
+// 带有转换器的信道，以常引用发布大数据，将深拷贝
+BENCHMARK_DEFINE_F(PubBench, ConvertCopied)(benchmark::State& st)
+{
+  const std::string data(st.range(0), 'x');
+
+  for (auto _ : st) {
+    std::string msg = data;
+    cvt_pub_.Publish(msg);
+  }
+}
+
+// 带有转换器的信道，以右值发布大数据，通过 ConvertMoved 移走数据
+BENCHMARK_DEFINE_F(PubBench, ConvertMoved)(benchmark::State& st)
+{
+  const std::string data(st.range(0), 'x');
+
+  for (auto _ : st) {
+    std::string msg = data;
+    cvt_pub_.Publish(std::move(msg));
+  }
+}
+
+// 带有转换器的信道，以常引用发布大数据，复用线程本地的转换缓冲区
+BENCHMARK_DEFINE_F(PubBench, ConvertReuseBuffer)(benchmark::State& st)
+{
+  const std::string data(st.range(0), 'x');
+
+  for (auto _ : st) {
+    cvt_reuse_pub_.Publish(data);
+  }
+}
+
+BENCHMARK_REGISTER_F(PubBench, ContextLookup)->MinTime(2);
+BENCHMARK_REGISTER_F(PubBench, BoundHandle)->MinTime(2);
+BENCHMARK_REGISTER_F(PubBench, ConvertCopied)->Arg(1 << 20)->MinTime(2);
+BENCHMARK_REGISTER_F(PubBench, ConvertMoved)->Arg(1 << 20)->MinTime(2);
+BENCHMARK_REGISTER_F(PubBench, ConvertReuseBuffer)->Arg(1 << 20)->MinTime(2);
+}
+
+BENCHMARK_MAIN();
@@ -0,0 +1,135 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include "src/test/test.h"
+#include "src/test_protocol/test_msg_new.pb.h"
+
+// 统计进程内所有的堆内存申请次数
+namespace
+{
+std::atomic_size_t g_alloc_count = 0;
+}
+
+void* operator new(const std::size_t size)
+{
+  g_alloc_count.fetch_add(1, std::memory_order_relaxed);
+  if (void* ptr = std::malloc(size))
+    return ptr;
+  throw std::bad_alloc();
+}
+
+void operator delete(void* ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void* ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace aimrte::bench
+{
+class SubBench : public benchmark::Fixture
+{
+ public:
+  void SetUp(const benchmark::State& st) override
+  {
+    aimrte::trait::renew(ctrl_);
+    ctrl_.SetConfigContent(
+      R"(
+aimrt:
+  configurator:
+    temp_cfg_path: ./cfg/tmp # 生成的临时模块配置文件存放路径
+  log: # log配置
+    core_lvl: Warn
+    default_module_lvl: Warn
+    backends: # 日志backends
+      - type: console # 控制台日志
+  executor:
+    executors:
+      - name: sub_executor
+        type: asio_thread
+        options:
+          thread_num: 1
+  channel: # 消息队列相关配置
+    backends: # 消息队列后端配置
+      - type: local # 本地消息队列配置
+        options:
+          subscriber_use_inline_executor: true
+)"
+    );
+
+    ctrl_.LetInit();
+
+    pub_ = ctx::init::Publisher<test_protocol::TestMsg>("/bench/sub");
+
+    const ctx::Executor exe                           = ctx::init::Executor("sub_executor");
+    const ctx::Subscriber<test_protocol::TestMsg> sub = ctx::init::Subscriber<test_protocol::TestMsg>("/bench/sub");
+
+    // 参数 0 为默认分发过程，参数 1 为池化的分发过程
+    sub.WhenInit().SubscribeOn(
+      exe,
+      [this](std::shared_ptr<const test_protocol::TestMsg>) {
+        received_.fetch_add(1, std::memory_order_relaxed);
+      },
+      {.pooled = st.range(0) == 1});
+
+    ctrl_.LetStart();
+    msg_.set_str("hello world");
+  }
+
+  void TearDown(const benchmark::State&) override
+  {
+    ctrl_.LetEnd();
+  }
+
+ protected:
+  void WaitReceived(const std::size_t expected) const
+  {
+    while (received_.load(std::memory_order_relaxed) < expected)
+      std::this_thread::yield();
+  }
+
+ protected:
+  test::ModuleTestController ctrl_;
+  ctx::Publisher<test_protocol::TestMsg> pub_;
+  test_protocol::TestMsg msg_;
+  std::atomic_size_t received_ = 0;
+};
+
+// 在执行器上订阅，统计每条消息从发布到回调结束，平均的堆内存申请次数
+BENCHMARK_DEFINE_F(SubBench, AllocationsPerMessage)(benchmark::State& st)
+{
+  constexpr std::size_t kBatch = 1000;
+
+  // 预热，使内存池进入稳定状态
+  for (std::size_t i = 0; i < kBatch; ++i)
+    pub_.Publish(msg_);
+  WaitReceived(kBatch);
+
+  std::size_t published   = kBatch;
+  std::size_t allocations = 0;
+
+  for (auto _ : st) {
+    const std::size_t begin = g_alloc_count.load();
+
+    for (std::size_t i = 0; i < kBatch; ++i)
+      pub_.Publish(msg_);
+
+    published += kBatch;
+    WaitReceived(published);
+
+    allocations += g_alloc_count.load() - begin;
+  }
+
+  st.SetItemsProcessed(st.iterations() * kBatch);
+  st.counters["allocs_per_msg"] = static_cast<double>(allocations) / static_cast<double>(st.iterations() * kBatch);
+}
+
+BENCHMARK_REGISTER_F(SubBench, AllocationsPerMessage)->ArgName("pooled")->Arg(0)->Arg(1)->MinTime(2);
+}
+
+BENCHMARK_MAIN();
@@ -0,0 +1,277 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include <benchmark/benchmark.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "src/sync/sync.h"
+
+namespace aimrte::bench
+{
+namespace
+{
+// 模拟较大的状态数据
+struct State {
+  std::array<double, 512> values{};
+};
+
+// 同一时刻仅存在一组并发的基准测试线程，共享同一份数据
+sync::AtomData<State> g_atom_data;
+sync::SnapshotData<State> g_snapshot_data;
+}  // namespace
+
+// 第 0 个线程持续写入，其余线程持续读取，统计读写的吞吐量。
+// 参数 0 为基于读写锁的 AtomData （读取时复制整份数据），参数 1 为基于快照的 SnapshotData
+static void LatestValueContention(benchmark::State& st)
+{
+  const bool snapshot = st.range(0) != 0;
+
+  State state;
+  double sum = 0;
+
+  for (auto _ : st) {
+    if (st.thread_index() == 0) {
+      state.values.front() += 1;
+
+      if (snapshot)
+        g_snapshot_data.Set(state);
+      else
+        g_atom_data.Set(state);
+    } else {
+      if (snapshot) {
+        if (const std::shared_ptr<const State> value = g_snapshot_data.Get(); value != nullptr)
+          sum += value->values.front();
+      } else {
+        sum += g_atom_data.Get().values.front();
+      }
+    }
+  }
+
+  benchmark::DoNotOptimize(sum);
+
+  st.counters[st.thread_index() == 0 ? "writes" : "reads"] = benchmark::Counter(static_cast<double>(st.iterations()), benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(LatestValueContention)->ArgName("snapshot")->Arg(0)->Arg(1)->ThreadRange(2, 16)->UseRealTime()->MinTime(1);
+
+namespace
+{
+sync::SharedMutex g_shared_mutex;
+std::shared_mutex g_std_shared_mutex;
+sync::Semaphore g_semaphore(4);
+}  // namespace
+
+// 读多写少的场景下，每个线程以 1/16 的概率加写锁，其余加读锁，统计加解锁的吞吐量。
+// 参数 0 为 std::shared_mutex ，参数 1 为协程读写锁 SharedMutex （经由同步接口调用）
+static void SharedMutexReadMostly(benchmark::State& st)
+{
+  const bool coroutine = st.range(0) != 0;
+
+  std::uint64_t n = 0;
+  for (auto _ : st) {
+    const bool write = (++n & 15) == 0;
+
+    if (coroutine) {
+      if (write) {
+        g_shared_mutex.lock();
+        g_shared_mutex.unlock();
+      } else {
+        g_shared_mutex.lock_shared();
+        g_shared_mutex.unlock_shared();
+      }
+    } else {
+      if (write) {
+        g_std_shared_mutex.lock();
+        g_std_shared_mutex.unlock();
+      } else {
+        g_std_shared_mutex.lock_shared();
+        g_std_shared_mutex.unlock_shared();
+      }
+    }
+  }
+
+  st.SetItemsProcessed(st.iterations());
+}
+
+BENCHMARK(SharedMutexReadMostly)->ArgName("coroutine")->Arg(0)->Arg(1)->ThreadRange(1, 16)->UseRealTime()->MinTime(1);
+
+// 多个线程竞争 4 个许可，统计获取与释放许可的吞吐量
+static void SemaphoreAcquireRelease(benchmark::State& st)
+{
+  for (auto _ : st) {
+    g_semaphore.Acquire().Sync();
+    g_semaphore.Release();
+  }
+
+  st.SetItemsProcessed(st.iterations());
+}
+
+BENCHMARK(SemaphoreAcquireRelease)->ThreadRange(1, 16)->UseRealTime()->MinTime(1);
+
+namespace
+{
+// 基准对比对象：以互斥锁与条件变量保护的 std::deque ，阻塞等待数据
+template <class T>
+class MutexQueue
+{
+ public:
+  void Push(T value)
+  {
+    {
+      std::lock_guard lock(mutex_);
+      queue_.push_back(std::move(value));
+    }
+    cv_.notify_one();
+  }
+
+  T Pop()
+  {
+    std::unique_lock lock(mutex_);
+    cv_.wait(lock, [this]() { return not queue_.empty(); });
+
+    T value = std::move(queue_.front());
+    queue_.pop_front();
+    return value;
+  }
+
+ private:
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::deque<T> queue_;
+};
+
+constexpr std::int64_t kChannelItems    = 1 << 16;
+constexpr std::size_t kChannelCapacity = 1024;
+
+// 由给定数量的生产者线程共同发送 kChannelItems 个数据，在当前线程上全部接收
+template <class TChannel>
+std::int64_t TransferByChannel(const int producers)
+{
+  TChannel channel(kChannelCapacity);
+  std::vector<std::thread> threads;
+
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&channel, producers]() {
+      for (std::int64_t i = 0; i < kChannelItems / producers; ++i)
+        channel.Send(i).Sync();
+    });
+  }
+
+  std::int64_t sum = 0;
+  for (std::int64_t i = 0; i < kChannelItems / producers * producers; ++i)
+    sum += *channel.Recv().Sync();
+
+  for (std::thread& t : threads)
+    t.join();
+
+  return sum;
+}
+
+std::int64_t TransferByMutexQueue(const int producers)
+{
+  MutexQueue<std::int64_t> queue;
+  std::vector<std::thread> threads;
+
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&queue, producers]() {
+      for (std::int64_t i = 0; i < kChannelItems / producers; ++i)
+        queue.Push(i);
+    });
+  }
+
+  std::int64_t sum = 0;
+  for (std::int64_t i = 0; i < kChannelItems / producers * producers; ++i)
+    sum += queue.Pop();
+
+  for (std::thread& t : threads)
+    t.join();
+
+  return sum;
+}
+}  // namespace
+
+// 多个生产者线程向一个消费者传递数据，统计传递的吞吐量。
+// 参数 0 为 std::mutex + std::deque ，参数 1 为 SpscChannel （仅 1 个生产者），参数 2 为 MpscChannel ；
+// 参数 1 为生产者的数量
+static void ChannelThroughput(benchmark::State& st)
+{
+  const std::int64_t kind = st.range(0);
+  const int producers     = static_cast<int>(st.range(1));
+
+  std::int64_t sum = 0;
+  for (auto _ : st) {
+    if (kind == 0)
+      sum += TransferByMutexQueue(producers);
+    else if (kind == 1)
+      sum += TransferByChannel<sync::SpscChannel<std::int64_t>>(producers);
+    else
+      sum += TransferByChannel<sync::MpscChannel<std::int64_t>>(producers);
+  }
+
+  benchmark::DoNotOptimize(sum);
+  st.SetItemsProcessed(st.iterations() * (kChannelItems / producers * producers));
+}
+
+BENCHMARK(ChannelThroughput)
+  ->ArgNames({"kind", "producers"})
+  ->Args({0, 1})
+  ->Args({1, 1})
+  ->Args({2, 1})
+  ->Args({0, 4})
+  ->Args({2, 4})
+  ->Args({0, 8})
+  ->Args({2, 8})
+  ->UseRealTime()
+  ->Unit(benchmark::kMillisecond);
+
+// 经由一对通道与回声线程往返传递一个数据，统计单次往返的延迟。
+// 参数 0 为 std::mutex + std::deque ，参数 1 为 SpscChannel
+static void ChannelPingPong(benchmark::State& st)
+{
+  const bool channel = st.range(0) != 0;
+
+  sync::SpscChannel<int> ping(kChannelCapacity), pong(kChannelCapacity);
+  MutexQueue<int> ping_queue, pong_queue;
+
+  // 回声线程收到负数时退出
+  std::thread echo([&]() {
+    while (true) {
+      const int value = channel ? *ping.Recv().Sync() : ping_queue.Pop();
+      if (value < 0)
+        return;
+
+      if (channel)
+        pong.Send(value).Sync();
+      else
+        pong_queue.Push(value);
+    }
+  });
+
+  int value = 0;
+  for (auto _ : st) {
+    if (channel) {
+      ping.Send(value).Sync();
+      value = *pong.Recv().Sync();
+    } else {
+      ping_queue.Push(value);
+      value = pong_queue.Pop();
+    }
+    ++value;
+  }
+
+  if (channel)
+    ping.Send(-1).Sync();
+  else
+    ping_queue.Push(-1);
+
+  echo.join();
+  st.SetItemsProcessed(st.iterations());
+}
+
+BENCHMARK(ChannelPingPong)->ArgName("channel")->Arg(0)->Arg(1)->UseRealTime();
+}  // namespace aimrte::bench
+
+BENCHMARK_MAIN();
@@ -204,6 +204,15 @@ aimrt::co::Task<void> MonitorPlugin::HeartBeat()
     AIMRTE_TRACE("send heartbeat:{}", aimrt::Pb2CompactJson(msg));
     heartbeat_publisher_.Publish(msg);
 
+    // 订阅队列的长度与丢弃情况
+    ReportSubscribeQueues();
+
+    // 周期循环的唤醒延迟与超时情况
+    ReportLoops();
+
+    // 执行器的排队深度与任务耗时
+    ReportExecutors();
+
     auto end_time       = std::chrono::steady_clock::now();
     int elapsed_time    = std::chrono::duration_cast<std::chrono::milliseconds>(end_time - start_time).count();
     auto sleep_duration = std::max(0, std::stoi(aimrte::utils::Env("AIMRTE_HEARTBEAT_INTERVAL", "1000")) - elapsed_time);
@@ -212,6 +221,75 @@ aimrt::co::Task<void> MonitorPlugin::HeartBeat()
   co_return;
 }
 
+// 按话题汇总订阅队列的长度与丢弃情况，出现新的丢弃时告警
+void MonitorPlugin::ReportSubscribeQueues()
+{
+  // 同一话题可能被多个模块订阅，按话题合并统计
+  std::unordered_map<std::string, aimrte::core::SubscribeStats> topic_stats;
+  for (const aimrte::core::TopicSubscribeStats& one : aimrte::core::CollectSubscribeStats()) {
+    aimrte::core::SubscribeStats& stats = topic_stats[one.topic_name];
+    stats.received += one.stats.received;
+    stats.dropped += one.stats.dropped;
+    stats.queued += one.stats.queued;
+    stats.capacity += one.stats.capacity;
+    stats.blocked += one.stats.blocked;
+  }
+
+  for (const auto& [topic_name, stats] : topic_stats) {
+    AIMRTE_TRACE(
+      "sub topic [{}] received: {}, dropped: {}, queued: {}/{}, blocked: {}",
+      topic_name, stats.received, stats.dropped, stats.queued, stats.capacity, stats.blocked);
+
+    // 仅在出现新的丢弃时告警
+    uint64_t& last_dropped = sub_dropped_[topic_name];
+    if (stats.dropped > last_dropped)
+      AIMRTE_WARN("sub topic [{}] dropped {} messages since last report, queued: {}/{}", topic_name, stats.dropped - last_dropped, stats.queued, stats.capacity);
+
+    last_dropped = stats.dropped;
+  }
+}
+
+// 汇总各周期循环的唤醒延迟与超时情况，出现新的超时时告警
+void MonitorPlugin::ReportLoops()
+{
+  for (const aimrte::ctx::NamedLoopStats& one : aimrte::ctx::CollectLoopStats()) {
+    const aimrte::ctx::LoopStats& stats = one.stats;
+
+    AIMRTE_TRACE(
+      "loop [{}] iterations: {}, overruns: {}, skipped: {}, latency mean: {}us, max: {}us",
+      one.name, stats.iterations, stats.overruns, stats.skipped,
+      stats.MeanLatency().count() / 1000, stats.max_latency.count() / 1000);
+
+    // 仅在出现新的超时时告警
+    uint64_t& last_overruns = loop_overruns_[one.name];
+    if (stats.overruns > last_overruns)
+      AIMRTE_WARN("loop [{}] overran {} times since last report, max latency: {}us", one.name, stats.overruns - last_overruns, stats.max_latency.count() / 1000);
+
+    last_overruns = stats.overruns;
+  }
+}
+
+// 汇总各执行器的排队深度与任务耗时，有任务排队却无任务完成时告警
+void MonitorPlugin::ReportExecutors()
+{
+  for (const aimrte::core::NamedExecutorStats& one : aimrte::core::CollectExecutorStats()) {
+    const aimrte::core::ExecutorStats& stats = one.stats;
+
+    uint64_t& last_executed = exe_executed_[one.name];
+
+    AIMRTE_TRACE(
+      "executor [{}] enqueued: {}, executed: {} (+{}), depth: {}/{}, wait mean: {}us, run mean: {}us",
+      one.name, stats.enqueued, stats.executed, stats.executed - last_executed, stats.depth, stats.max_depth,
+      stats.MeanWait().count() / 1000, stats.MeanRun().count() / 1000);
+
+    // 有任务排队，但自上次上报以来没有任务完成，执行器可能已被阻塞
+    if (stats.depth > 0 and stats.executed == last_executed)
+      AIMRTE_WARN("executor [{}] has {} queued tasks but executed none since last report", one.name, stats.depth);
+
+    last_executed = stats.executed;
+  }
+}
+
 /**
  * @brief 1S 统计一次系统资源信息
  * @return
@@ -49,6 +49,15 @@ class MonitorPlugin : public aimrt::AimRTCorePluginBase
   ProcessResourceInfo self_process_res_info_;
   std::mutex self_process_res_info_mutex_;
 
+  // 各订阅话题上一次上报时的丢弃消息数量
+  std::unordered_map<std::string, uint64_t> sub_dropped_;
+
+  // 各周期循环上一次上报时的超时次数
+  std::unordered_map<std::string, uint64_t> loop_overruns_;
+
+  // 各执行器上一次上报时的已执行任务数量
+  std::unordered_map<std::string, uint64_t> exe_executed_;
+
  private:
   void RegisterMonitorChannelBackend();
   void RegisterMonitorRpcBackend();
@@ -57,6 +66,9 @@ class MonitorPlugin : public aimrt::AimRTCorePluginBase
   void DoInitliaze();
 
   aimrt::co::Task<void> HeartBeat();
+  void ReportSubscribeQueues();
+  void ReportLoops();
+  void ReportExecutors();
   aimrt::co::Task<void> CollectResourceInfo();
 
  public:
@@ -151,6 +151,12 @@ struct By {
   {
     return impl::Convert<TAnother, TOriginal>;
   }
+
+  template <class TOriginal>
+  static constexpr auto FromOriginalMoved()
+  {
+    return impl::ConvertMoved<TOriginal, TAnother>;
+  }
 };
 
 /**
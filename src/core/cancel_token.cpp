@@ -0,0 +1,71 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./cancel_token.h"
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace aimrte::core
+{
+struct CancelToken::State {
+  std::atomic_bool cancelled{false};
+
+  // 保护回调列表，回调本身在锁外执行，以便回调中再次访问本令牌
+  std::mutex mutex;
+  std::vector<std::pair<const void*, std::function<void()>>> callbacks;
+};
+
+CancelToken::CancelToken()
+    : state_(std::make_shared<State>())
+{
+}
+
+void CancelToken::Cancel() const
+{
+  std::vector<std::pair<const void*, std::function<void()>>> callbacks;
+
+  {
+    const std::lock_guard lock(state_->mutex);
+    if (state_->cancelled.exchange(true, std::memory_order::acq_rel))
+      return;
+
+    callbacks.swap(state_->callbacks);
+  }
+
+  for (auto& [key, func] : callbacks)
+    func();
+}
+
+bool CancelToken::IsCancelled() const
+{
+  return state_->cancelled.load(std::memory_order::acquire);
+}
+
+bool CancelToken::Register(const void* key, std::function<void()> func) const
+{
+  const std::lock_guard lock(state_->mutex);
+  if (state_->cancelled.load(std::memory_order::relaxed))
+    return false;
+
+  state_->callbacks.emplace_back(key, std::move(func));
+  return true;
+}
+
+void CancelToken::Unregister(const void* key) const
+{
+  const std::lock_guard lock(state_->mutex);
+
+  auto& callbacks = state_->callbacks;
+  auto iter       = std::ranges::find(callbacks, key, &std::pair<const void*, std::function<void()>>::first);
+
+  if (iter == callbacks.end())
+    return;
+
+  // 回调之间没有顺序要求，与末尾交换后移除
+  *iter = std::move(callbacks.back());
+  callbacks.pop_back();
+}
+}  // namespace aimrte::core
@@ -0,0 +1,50 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <functional>
+#include <memory>
+
+namespace aimrte::core
+{
+/**
+ * @brief 取消令牌，用于中止尚未完成的等待。
+ *
+ * 令牌的副本共享同一份状态，任一副本上的 Cancel() 对所有副本可见，且只生效一次。
+ * 等待方通过 Register 登记取消时的回调，等待结束后以同一个键 Unregister ；回调在调用 Cancel() 的线程上执行。
+ * 每个模块的上下文持有一个令牌，在模块被要求退出时取消，见 Context::ShutdownToken() 。
+ */
+class CancelToken
+{
+ public:
+  CancelToken();
+
+  /**
+   * @brief 取消本令牌，并执行所有已登记的回调
+   */
+  void Cancel() const;
+
+  /**
+   * @return 本令牌是否已被取消
+   */
+  [[nodiscard]] bool IsCancelled() const;
+
+  /**
+   * @brief 登记取消时的回调
+   * @param key  用于注销的键，通常是等待者的地址，同一时刻不可重复
+   * @param func 取消时执行的回调
+   * @return 是否登记成功，令牌已被取消时返回 false ，且不会执行回调
+   */
+  bool Register(const void* key, std::function<void()> func) const;
+
+  /**
+   * @brief 注销取消时的回调，回调不存在（或已被执行）时不做任何事情
+   */
+  void Unregister(const void* key) const;
+
+ private:
+  struct State;
+  std::shared_ptr<State> state_;
+};
+}  // namespace aimrte::core
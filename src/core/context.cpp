@@ -27,7 +27,13 @@ res::Executor Context::InitExecutor(const std::string_view& name, const std::sou
 
   // 初始化成功，维护该执行器
   executors_.push_back(executor);
-  log(call_loc).Info("Init executor [{}] succeeded.", name);
+  timer_wheels_.push_back(details::TimerWheelRegistry::Instance().Get(executor));
+  executor_counters_.push_back(details::GetExecutorCounter(std::string(name)));
+
+  if (const auto& wheel = timer_wheels_.back(); wheel != nullptr)
+    log(call_loc).Info("Init executor [{}] succeeded, with timer wheel of tick {}ns.", name, wheel->Tick().count());
+  else
+    log(call_loc).Info("Init executor [{}] succeeded.", name);
 
   // 返回该执行器的资源描述
   res::Executor res;
@@ -50,6 +56,12 @@ bool Context::Ok() const
 void Context::RequireToShutdown()
 {
   is_ok_ = false;
+  shutdown_token_.Cancel();
+}
+
+const CancelToken& Context::ShutdownToken() const
+{
+  return shutdown_token_;
 }
 
 bool Context::EnableTrace() const
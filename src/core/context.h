@@ -19,13 +19,27 @@
 #include "src/macro/macro.h"
 #include "src/panic/panic.h"
 #include "src/res/res.h"
+#include "./cancel_token.h"
 #include "./coroutine.h"
+#include "./details/block_pool.h"
+#include "./details/bounded_queue.h"
 #include "./details/concepts.h"
+#include "./details/conflate_slot.h"
+#include "./details/convert_cache.h"
+#include "./details/object_pool.h"
+#include "./details/thread_local_buffer.h"
 #include "./details/type_support.h"
+#include "./executor_stats.h"
+#include "./intra_process.h"
+#include "./priority.h"
 #include "./mock/i_mock_client.h"
 #include "./mock/i_mock_publisher.h"
 #include "./mock/i_mock_server.h"
 #include "./mock/i_mock_subscriber.h"
+#include "./publish_option.h"
+#include "./subscribe_option.h"
+#include "./subscribe_stats.h"
+#include "./timer_wheel.h"
 
 
 namespace aimrte::core
@@ -51,6 +65,9 @@ class Context : public std::enable_shared_from_this<Context>
   class OpCheck;
   class OpRaise;
 
+  template <class T>
+  class PublishHandle;
+
   explicit Context(aimrt::CoreRef core);
 
   ~Context();
@@ -123,6 +140,12 @@ class Context : public std::enable_shared_from_this<Context>
   template <class T>
   using PublishFunction = std::function<void(aimrt::channel::PublisherRef, aimrt::channel::ContextRef, const T&)>;
 
+  template <class T>
+  using RawPublishFunction = void (*)(aimrt::channel::PublisherRef, aimrt::channel::ContextRef, const T&);
+
+  template <class T>
+  using RawPublishMovedFunction = void (*)(aimrt::channel::PublisherRef, aimrt::channel::ContextRef, T&&);
+
   template <class T>
   using ChannelCallback = std::function<co::Task<void>(std::shared_ptr<const T>)>;
 
@@ -132,7 +155,9 @@ class Context : public std::enable_shared_from_this<Context>
       aimrt::channel::SubscriberRef,
       ChannelCallback<T>,
       std::weak_ptr<Context>,
-      res::Executor)>;
+      res::Executor,
+      const SubscribeOption&,
+      std::shared_ptr<details::SubscribeCounter>)>;
 
   struct ChannelContext {
     // 原生的发布器（无论会不会发布，总是会初始化）
@@ -144,8 +169,23 @@ class Context : public std::enable_shared_from_this<Context>
     // 擦除了类型的发送函数（PublishFunction<T>）
     std::any pub_f;
 
+    // 擦除了类型的原生发送函数指针（RawPublishFunction<T>），仅真实发布器会设置，mock 时为空
+    std::any raw_pub_f;
+
+    // 擦除了类型的、移入数据的原生发送函数指针（RawPublishMovedFunction<T>），仅带有转换器的真实发布器会设置
+    std::any raw_pub_moved_f;
+
     // 擦除了类型的订阅函数（SubscribeFunction<T>）
     std::any sub_f;
+
+    // 订阅的统计计数器（仅真实订阅器会初始化）
+    std::shared_ptr<details::SubscribeCounter> sub_counter;
+
+    // 订阅队列的默认配置，在注册回调时未指定队列配置时使用
+    QueueOption sub_queue;
+
+    // 进程内信道，仅当该话题启用了进程内通信时存在
+    std::shared_ptr<details::IntraProcessTopic> intra;
   };
 
   template <class Q, class P>
@@ -239,6 +279,12 @@ class Context : public std::enable_shared_from_this<Context>
   // 申请的执行器资源
   std::vector<aimrt::executor::ExecutorRef> executors_;
 
+  // 与执行器一一对应的时间轮，同一执行器上的各个上下文共享同一个；未启用时为空
+  std::vector<std::shared_ptr<details::TimerWheel>> timer_wheels_;
+
+  // 与执行器一一对应的任务统计计数器，未启用时为空
+  std::vector<std::shared_ptr<details::ExecutorCounter>> executor_counters_;
+
   // 发布订阅通信资源上下文
   std::vector<ChannelContext> channel_contexts_;
 
@@ -297,10 +343,15 @@ class Context : public std::enable_shared_from_this<Context>
   bool Ok() const;
 
   /**
-   * @brief 要求模块退出，但只设置了标识，供模块子类实现者参考使用
+   * @brief 要求模块退出，设置标识供模块子类实现者参考使用，并取消本模块的退出令牌
    */
   void RequireToShutdown();
 
+  /**
+   * @return 本模块的退出令牌，在模块被要求退出时取消，可用于中止同步原语上的等待
+   */
+  [[nodiscard]] const CancelToken& ShutdownToken() const;
+
   /**
    * @return 是否启用 trace 功能
    */
@@ -315,6 +366,9 @@ class Context : public std::enable_shared_from_this<Context>
   // 是否被要求关闭。该状态量可以被 ctx 接口获取
   std::atomic_bool is_ok_ = true;
 
+  // 模块的退出令牌，与 is_ok_ 同时变化
+  CancelToken shutdown_token_;
+
   // 是否被允许启用 trace 功能
   bool enable_trace_ = false;
 };
@@ -408,7 +462,7 @@ void Context::LogAndThrow(
 template <class T>
 Context::ChannelContext& Context::GetChannelContext(const res::Channel<T>& ch, const std::source_location call_loc)
 {
-  check(id_ == ch.context_id_, call_loc).ErrorThrow("Wrong use of res::Channel [{}], current context is [{}], but yours is [{}].", ch.name_, id_, ch.context_id_);
+  check(id_ == ch.context_id_, call_loc).ErrorThrow("Wrong use of res::Channel [{}], current context is [{}], but yours is [{}].", ch.GetName(), id_, ch.context_id_);
 
   return channel_contexts_[ch.idx_];
 }
@@ -416,7 +470,7 @@ Context::ChannelContext& Context::GetChannelContext(const res::Channel<T>& ch, c
 template <class Q, class P>
 Context::ServiceContext& Context::GetServiceContext(const res::Service<Q, P>& srv, const std::source_location call_loc)
 {
-  check(id_ == srv.context_id_, call_loc).ErrorThrow("Wrong use of res::Service [{}], current context is [{}], but yours is [{}].", srv.name_, id_, srv.context_id_);
+  check(id_ == srv.context_id_, call_loc).ErrorThrow("Wrong use of res::Service [{}], current context is [{}], but yours is [{}].", srv.GetName(), id_, srv.context_id_);
 
   return service_contexts_[srv.idx_];
 }
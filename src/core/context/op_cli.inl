@@ -81,7 +81,7 @@ res::Service<Q, P> Context::OpCli::InitService(res::Service<QRaw, PRaw>&& srv)
 
   // 准备新的资源标识符
   res::Service<Q, P> new_srv;
-  new_srv.name_       = std::move(srv.name_);
+  new_srv.name_       = srv.name_;
   new_srv.idx_        = srv.idx_;
   new_srv.context_id_ = ctx_.id_;
 
@@ -249,7 +249,7 @@ co::Task<aimrt::rpc::Status> Context::OpCli::DoCall(
     assert(rpc_ctx.NativeHandle() != nullptr);
 
     // 检查是否从上游收到 trace 信息，若没有，则开始新的 trace
-    if (const auto & opt = details::g_thread_ctx.active_rpc_context; opt.has_value()) {
+    if (const auto & opt = details::g_thread_ctx->active_rpc_context; opt.has_value()) {
       ctx.core_.GetRpcHandle().MergeServerContextToClientContext(*opt, rpc_ctx);
 
       if (rpc_ctx.GetMetaValue("aimrt_otp-traceparent").empty())
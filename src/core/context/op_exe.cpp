@@ -22,12 +22,19 @@ void Context::OpExe::CheckAndInit()
   ctx_.check(ctx_.id_ == res_.context_id_, loc_)
     .ErrorThrow(
       "Wrong use of res::Executor [{}], current context is [{}], but yours is [{}].",
-      res_.name_, ctx_.id_, res_.context_id_);
-  executor_ = ctx_.executors_[res_.idx_];
+      res_.GetName(), ctx_.id_, res_.context_id_);
+  executor_    = ctx_.executors_[res_.idx_];
+  timer_wheel_ = ctx_.timer_wheels_[res_.idx_].get();
+  counter_     = ctx_.executor_counters_[res_.idx_].get();
 }
 
 aimrt::executor::ExecutorRef Context::OpExe::GetRawRef(const OpExe& ref)
 {
   return ref.executor_;
 }
+
+details::TimerWheel* Context::OpExe::GetTimerWheel(const OpExe& ref)
+{
+  return ref.timer_wheel_;
+}
 }  // namespace aimrte::core
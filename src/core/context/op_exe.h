@@ -17,9 +17,10 @@ class Context::OpExe : public OpBase
    * @brief 在当前执行器上，注册指定的信道资源的消息回调。
    * @param ch       信道资源标识符
    * @param callback 回调函数或协程，参数为 std::shared_ptr<T> 或 const T&
+   * @param option   订阅的可选配置
    */
   template <class T, concepts::SupportedSubscriber<T> TCallback>
-  OpExe& Subscribe(const res::Channel<T>& ch, TCallback callback);
+  OpExe& Subscribe(const res::Channel<T>& ch, TCallback callback, const SubscribeOption& option = {});
 
   /**
    * @brief 在当前执行器上，注册指定服务资源的服务处理回调。
@@ -48,6 +49,14 @@ class Context::OpExe : public OpBase
     requires concepts::SupportedInvoker<F>
   OpExe& Post(aimrt::co::AsyncScope& scope, F f);
 
+  /**
+   * @brief 在本执行器中，以给定的优先级执行给定函数或协程。
+   *        仅支持优先级的执行器（如 priority_thread）会按优先级调度，其他执行器等同于 Post(f) 。
+   */
+  template <class F>
+    requires concepts::SupportedInvoker<F>
+  OpExe& Post(Priority prio, F f);
+
   /**
    * @brief 在本执行器中，原地执行完给定函数或协程
    */
@@ -57,6 +66,7 @@ class Context::OpExe : public OpBase
 
  private:
   friend class Context;
+  friend class OpSub;
 
   OpExe(Context& ctx, const res::Executor& res, std::source_location loc);
   OpExe(Context& ctx, res::Executor&& res, std::source_location loc);
@@ -66,6 +76,13 @@ class Context::OpExe : public OpBase
    */
   void CheckAndInit();
 
+  /**
+   * @brief 在本执行器中，直接启动由 make_task 创建的协程，不再额外包装协程。
+   *        make_task 将在上下文数据准备好之后被调用，返回 co::Task<void> 。
+   */
+  template <class F>
+  OpExe& Spawn(F&& make_task);
+
   /**
    * @brief 标准化供执行器执行的任务为 co::Task<void>()
    */
@@ -78,6 +95,11 @@ class Context::OpExe : public OpBase
    */
   static aimrt::executor::ExecutorRef GetRawRef(const OpExe& ref);
 
+  /**
+   * @return 执行器的时间轮，未启用时为空指针
+   */
+  static details::TimerWheel* GetTimerWheel(const OpExe& ref);
+
  private:
   // 执行器的资源临时对象，若用户导出执行器接口，使用了临时资源对象时，我们需要暂存它。
   // 我们不会直接使用它。
@@ -88,5 +110,11 @@ class Context::OpExe : public OpBase
 
   // 执行器
   aimrt::executor::ExecutorRef executor_;
+
+  // 执行器的时间轮，可能为空
+  details::TimerWheel* timer_wheel_ = nullptr;
+
+  // 执行器的任务统计计数器，未启用统计时为空
+  details::ExecutorCounter* counter_ = nullptr;
 };
 }  // namespace aimrte::core
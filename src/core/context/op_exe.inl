@@ -7,9 +7,9 @@
 namespace aimrte::core
 {
 template <class T, concepts::SupportedSubscriber<T> TCallback>
-Context::OpExe& Context::OpExe::Subscribe(const res::Channel<T>& ch, TCallback callback)
+Context::OpExe& Context::OpExe::Subscribe(const res::Channel<T>& ch, TCallback callback, const SubscribeOption& option)
 {
-  ctx_.sub(loc_).DoSubscribe(ch, std::move(callback), res_);
+  ctx_.sub(loc_).DoSubscribe(ch, std::move(callback), res_, option);
   return *this;
 }
 
@@ -31,15 +31,68 @@ template <class F>
   requires concepts::SupportedInvoker<F>
 Context::OpExe& Context::OpExe::Post(aimrt::co::AsyncScope& scope, F f)
 {
+  // 未经 Post(prio, f) 指定优先级的投递，显式地使用默认优先级，而不沿用当前任务的优先级
+  const std::optional<Priority> prev = details::g_post_priority;
+  details::g_post_priority           = prev.value_or(Priority::Normal);
+  AIMRTE(defer(details::g_post_priority = prev));
+
   // 为即将创建的协程，准备好上下文数据，该协程将在 init 时取走
   details::g_thread_ctx = {ctx_.weak_from_this(), res_};
 
   // 启动协程
+  if (counter_ == nullptr) {
+    scope.spawn_on(
+      aimrt::co::AimRTScheduler(executor_),
+      [](auto _f) -> co::Task<void> {
+        co_return co_await _f();
+      }(StandardizeInvoker(std::move(f))));
+
+    return *this;
+  }
+
+  // 启用了统计时，额外记录任务的排队与运行情况。守卫存放在协程帧中，
+  // 即使 scope 已被停止、协程帧未经执行就被销毁，排队的计数也会被归还
   scope.spawn_on(
     aimrt::co::AimRTScheduler(executor_),
-    [](auto _f) -> co::Task<void> {
+    [](auto _f, details::ExecutorTaskGuard guard) -> co::Task<void> {
+      guard.Start();
       co_return co_await _f();
-    }(StandardizeInvoker(std::move(f))));
+    }(StandardizeInvoker(std::move(f)), details::ExecutorTaskGuard(*counter_)));
+
+  return *this;
+}
+
+template <class F>
+  requires concepts::SupportedInvoker<F>
+Context::OpExe& Context::OpExe::Post(const Priority prio, F f)
+{
+  // 执行器在投递时读取该优先级，投递完成后恢复，不影响当前任务后续的投递
+  const std::optional<Priority> prev = details::g_post_priority;
+  details::g_post_priority           = prio;
+  AIMRTE(defer(details::g_post_priority = prev));
+
+  return Post(std::move(f));
+}
+
+template <class F>
+Context::OpExe& Context::OpExe::Spawn(F&& make_task)
+{
+  // 为即将创建的协程，准备好上下文数据，该协程将在 init 时取走
+  details::g_thread_ctx = {ctx_.weak_from_this(), res_};
+
+  // 启动协程
+  if (counter_ == nullptr) {
+    ctx_.async_scope_.spawn_on(aimrt::co::AimRTScheduler(executor_), std::forward<F>(make_task)());
+    return *this;
+  }
+
+  // 启用了统计时，与 Post 相同，由存放在协程帧中的守卫记录任务的排队与运行情况
+  ctx_.async_scope_.spawn_on(
+    aimrt::co::AimRTScheduler(executor_),
+    [](co::Task<void> task, details::ExecutorTaskGuard guard) -> co::Task<void> {
+      guard.Start();
+      co_await std::move(task);
+    }(std::forward<F>(make_task)(), details::ExecutorTaskGuard(*counter_)));
 
   return *this;
 }
@@ -0,0 +1,19 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "../context.h"
+
+namespace aimrte::core
+{
+void Context::OpPub::StartTrace(aimrt::channel::ContextRef ch_ctx)
+{
+  assert(ch_ctx.NativeHandle() != nullptr);
+
+  // TODO: 也许新增 publish 接口，传入 sub_ctx 与 pub_ctx，才能用起来下述过程
+  // 本 publish 传入 ch_ctx 接口也暂时没有对外开放
+  // pub_ctx.pub.MergeSubscribeContextToPublishContext()
+
+  if (ch_ctx.GetMetaValue("aimrt_otp-traceparent").empty())
+    ch_ctx.SetMetaValue("aimrt_otp-start_new_trace", "True");
+}
+}  // namespace aimrte::core
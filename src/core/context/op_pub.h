@@ -25,10 +25,11 @@ class Context::OpPub : public OpBase
    * @tparam T          用户自定义类型
    * @tparam TConverter 用于转换用户类型到通信类型的转化器，其中定义了通信类型
    * @param topic_name  话题名称
+   * @param option      发布信道的可选配置
    * @return 信道资源标识符，将用于后续发布数据。
    */
   template <class T, concepts::ByConverter TConverter>
-  [[nodiscard]] res::Channel<T> Init(const std::string_view& topic_name);
+  [[nodiscard]] res::Channel<T> Init(const std::string_view& topic_name, const PublishOption& option = {});
 
   /**
    * @brief 初始化一个被测发布通道资源
@@ -50,7 +51,45 @@ class Context::OpPub : public OpBase
   template <class T>
   void Publish(const res::Channel<T>& ch, aimrt::channel::ContextRef ch_ctx, const T& msg);
 
+  /**
+   * @brief 使用指定信道资源，发布可被移走的数据。对于带有转换器的信道，将通过
+   *        impl::ConvertMoved 转换，避免深拷贝；其余情况与常引用版本相同。
+   */
+  template <class T>
+  void Publish(const res::Channel<T>& ch, T&& msg);
+
+  /**
+   * @brief 使用指定信道资源，发布可被移走的数据，同时给定应用 channel 上下文
+   */
+  template <class T>
+  void Publish(const res::Channel<T>& ch, aimrt::channel::ContextRef ch_ctx, T&& msg);
+
+  /**
+   * @brief 使用指定信道资源，发布共享的数据。对于启用了进程内通信的话题，订阅者将直接共享该对象，
+   *        不经过序列化与拷贝；其余情况与常引用版本相同。
+   * @note  发布后，调用者不应再修改该对象。
+   */
+  template <class T>
+  void PublishShared(const res::Channel<T>& ch, std::shared_ptr<const T> msg);
+
+  /**
+   * @brief 将指定信道资源解析为带类型的发布句柄，缓存原生发布器与发布函数，
+   *        以便在高频发布时，跳过信道上下文的查找与类型擦除的调用。
+   * @param ch 信道资源描述符，若资源没有正确初始化或使用，将报错
+   * @return 发布句柄。若该信道被 mock 接管，将返回无效句柄，调用者应退回 Publish 接口。
+   */
+  template <class T>
+  [[nodiscard]] PublishHandle<T> Bind(const res::Channel<T>& ch);
+
  private:
+  template <class>
+  friend class Context::PublishHandle;
+
+  /**
+   * @brief 为 channel 上下文添加 trace 相关信息，确保 trace 被启动
+   */
+  static void StartTrace(aimrt::channel::ContextRef ch_ctx);
+
   /**
    * @brief 基础的 channel pub 初始化过程，原生的 pub ref 将被初始化，发布类型 TRaw 将被注册。
    * 其余上下文需要由调用者进一步完善。
@@ -68,10 +107,85 @@ class Context::OpPub : public OpBase
   template <concepts::DirectlySupportedType T>
   static PublishFunction<T> CreatePublishFunction();
 
+
   /**
-   * @return 转换类型后，发布数据的函数
+   * @return 发布数据的原生函数指针
    */
-  template <class T, concepts::ByConverter TConverter>
-  static PublishFunction<T> CreatePublishFunction();
+  template <concepts::DirectlySupportedType T>
+  static RawPublishFunction<T> CreateRawPublishFunction();
+
+  /**
+   * @brief 为带有转换器的信道，设置常引用与移入数据两种发布函数
+   * @tparam kReuseBuffer 转换后的通信类型对象，是否使用线程本地的缓冲区
+   */
+  template <class T, concepts::ByConverter TConverter, bool kReuseBuffer>
+  static void SetConvertedPublishFunctions(ChannelContext& pub_ctx);
+
+  /**
+   * @brief 为启用了进程内通信的信道，设置共享消息对象的发布函数
+   */
+  template <class T>
+  static void SetIntraProcessPublishFunction(ChannelContext& pub_ctx);
+
+  /**
+   * @brief 转换数据类型后发布，数据为右值时，使用 impl::ConvertMoved 转换
+   */
+  template <class T, concepts::ByConverter TConverter, bool kReuseBuffer, class TSrc>
+  static void ConvertAndPublish(aimrt::channel::PublisherRef pub, aimrt::channel::ContextRef ch_ctx, TSrc&& src_msg);
+};
+
+/**
+ * @brief 带类型的发布句柄，在初始化阶段由 OpPub::Bind 创建，缓存了原生发布器，
+ *        以及未擦除类型的发布函数指针，发布过程为一次直接调用。
+ * @note  句柄不持有 Context ，仅可在其所属模块的生命周期内使用。
+ */
+template <class T>
+class Context::PublishHandle
+{
+ public:
+  PublishHandle() = default;
+
+  /**
+   * @return 是否绑定了有效的发布器
+   */
+  [[nodiscard]] bool IsValid() const
+  {
+    return pub_f_ != nullptr;
+  }
+
+  /**
+   * @brief 通过本句柄发布数据，调用者需保证句柄有效
+   */
+  void Publish(const T& msg) const;
+
+  /**
+   * @brief 通过本句柄发布数据，同时给定应用 channel 上下文
+   */
+  void Publish(aimrt::channel::ContextRef ch_ctx, const T& msg) const;
+
+  /**
+   * @brief 通过本句柄发布可被移走的数据，调用者需保证句柄有效
+   */
+  void Publish(T&& msg) const;
+
+  /**
+   * @brief 通过本句柄发布可被移走的数据，同时给定应用 channel 上下文
+   */
+  void Publish(aimrt::channel::ContextRef ch_ctx, T&& msg) const;
+
+ private:
+  friend class OpPub;
+
+  // 原生的发布器
+  aimrt::channel::PublisherRef pub_;
+
+  // 未擦除类型的发布函数
+  RawPublishFunction<T> pub_f_ = nullptr;
+
+  // 未擦除类型的、移入数据的发布函数，仅带有转换器的信道会设置
+  RawPublishMovedFunction<T> pub_moved_f_ = nullptr;
+
+  // 绑定时所属 Context 是否启用了 trace 功能
+  bool enable_trace_ = false;
 };
 }  // namespace aimrte::core
@@ -13,7 +13,12 @@ res::Channel<T> Context::OpPub::Init(const std::string_view& topic_name)
   auto [ch, ch_ctx] = DoInit<T>(topic_name);
 
   // 基于该类型，设置发布函数与订阅函数
-  ch_ctx.pub_f = CreatePublishFunction<T>();
+  ch_ctx.pub_f     = CreatePublishFunction<T>();
+  ch_ctx.raw_pub_f = CreateRawPublishFunction<T>();
+
+  // 进程内通信的话题，改为共享消息对象的发布过程
+  if (ch_ctx.intra != nullptr)
+    SetIntraProcessPublishFunction<T>(ch_ctx);
 
   // 返回该发布器的资源描述符
   return ch;
@@ -21,15 +26,22 @@ res::Channel<T> Context::OpPub::Init(const std::string_view& topic_name)
 
 template <class T, concepts::ByConverter TConverter>
 res::Channel<T>
-Context::OpPub::Init(const std::string_view& topic_name)
+Context::OpPub::Init(const std::string_view& topic_name, const PublishOption& option)
 {
   using TRaw = typename TConverter::AnotherType;
 
   // 以当前的类型，以及话题名称，创建新的信道上下文
   auto [ch, ch_ctx] = DoInit<T, TRaw>(topic_name);
 
-  // 基于该类型，设置发布函数与订阅函数
-  ch_ctx.pub_f = CreatePublishFunction<T, TConverter>();
+  // 基于该类型与发布配置，设置发布函数
+  if (option.reuse_buffer)
+    SetConvertedPublishFunctions<T, TConverter, true>(ch_ctx);
+  else
+    SetConvertedPublishFunctions<T, TConverter, false>(ch_ctx);
+
+  // 进程内通信的话题，改为共享消息对象的发布过程，不再转换类型
+  if (ch_ctx.intra != nullptr)
+    SetIntraProcessPublishFunction<T>(ch_ctx);
 
   // 返回该发布器的资源描述符
   return ch;
@@ -65,24 +77,87 @@ void Context::OpPub::Publish(const res::Channel<T>& ch, const T& msg)
 }
 
 template <class T>
-void Context::OpPub::Publish(const res::Channel<T> &ch, aimrt::channel::ContextRef ch_ctx, const T &msg) {
+void Context::OpPub::Publish(const res::Channel<T>& ch, aimrt::channel::ContextRef ch_ctx, const T& msg)
+{
   // 取出信道上下文
   ChannelContext& pub_ctx = ctx_.GetChannelContext(ch, loc_);
 
   // 若允许 trace，则为 channel 上下文添加相关信息，确保 trace 被启动
-  if (ctx_.enable_trace_) [[unlikely]] {
-    assert(ch_ctx.NativeHandle() != nullptr);
+  if (ctx_.enable_trace_) [[unlikely]]
+    StartTrace(ch_ctx);
+
+  // 通过该信道的上下文，发布数据
+  std::any_cast<PublishFunction<T>&>(pub_ctx.pub_f)(pub_ctx.pub, ch_ctx, msg);
+}
+
+template <class T>
+void Context::OpPub::Publish(const res::Channel<T>& ch, T&& msg)
+{
+  aimrt::channel::Context ch_ctx;
+  Publish(ch, ch_ctx, std::move(msg));
+}
 
-    // TODO: 也许新增 publish 接口，传入 sub_ctx 与 pub_ctx，才能用起来下述过程
-    // 本 publish 传入 ch_ctx 接口也暂时没有对外开放
-    // pub_ctx.pub.MergeSubscribeContextToPublishContext()
+template <class T>
+void Context::OpPub::Publish(const res::Channel<T>& ch, aimrt::channel::ContextRef ch_ctx, T&& msg)
+{
+  // 取出信道上下文
+  ChannelContext& pub_ctx = ctx_.GetChannelContext(ch, loc_);
 
-    if (ch_ctx.GetMetaValue("aimrt_otp-traceparent").empty())
-      ch_ctx.SetMetaValue("aimrt_otp-start_new_trace", "True");
+  // 进程内通信的话题，直接将数据移入共享的消息对象
+  if (pub_ctx.intra != nullptr) {
+    pub_ctx.intra->Publish(std::make_shared<const T>(std::move(msg)));
+    return;
   }
 
+  // 没有移入数据的发布函数时（无转换器、或被 mock 接管），与常引用版本相同
+  const auto* pub_moved_f = std::any_cast<RawPublishMovedFunction<T>>(&pub_ctx.raw_pub_moved_f);
+  if (pub_moved_f == nullptr) {
+    Publish(ch, ch_ctx, static_cast<const T&>(msg));
+    return;
+  }
+
+  // 若允许 trace，则为 channel 上下文添加相关信息，确保 trace 被启动
+  if (ctx_.enable_trace_) [[unlikely]]
+    StartTrace(ch_ctx);
+
   // 通过该信道的上下文，发布数据
-  std::any_cast<PublishFunction<T>&>(pub_ctx.pub_f)(pub_ctx.pub, ch_ctx, msg);
+  (*pub_moved_f)(pub_ctx.pub, ch_ctx, std::move(msg));
+}
+
+template <class T>
+void Context::OpPub::PublishShared(const res::Channel<T>& ch, std::shared_ptr<const T> msg)
+{
+  // 取出信道上下文
+  ChannelContext& pub_ctx = ctx_.GetChannelContext(ch, loc_);
+
+  // 进程内通信的话题，直接共享给订阅者；其余情况与常引用版本相同
+  if (pub_ctx.intra != nullptr) {
+    pub_ctx.intra->Publish(std::move(msg));
+    return;
+  }
+
+  Publish(ch, *msg);
+}
+
+template <class T>
+Context::PublishHandle<T> Context::OpPub::Bind(const res::Channel<T>& ch)
+{
+  // 取出信道上下文
+  const ChannelContext& pub_ctx = ctx_.GetChannelContext(ch, loc_);
+
+  // 被 mock 接管、或启用了进程内通信的信道没有原生发布函数，返回无效句柄
+  PublishHandle<T> handle;
+  if (not pub_ctx.raw_pub_f.has_value())
+    return handle;
+
+  handle.pub_          = pub_ctx.pub;
+  handle.pub_f_        = std::any_cast<RawPublishFunction<T>>(pub_ctx.raw_pub_f);
+  handle.enable_trace_ = ctx_.enable_trace_;
+
+  if (pub_ctx.raw_pub_moved_f.has_value())
+    handle.pub_moved_f_ = std::any_cast<RawPublishMovedFunction<T>>(pub_ctx.raw_pub_moved_f);
+
+  return handle;
 }
 
 template <class T, concepts::DirectlySupportedType TRaw>
@@ -99,6 +174,11 @@ std::pair<res::Channel<T>, Context::ChannelContext&> Context::OpPub::DoInit(cons
   if (not aimrt::channel::RegisterPublishType<TRaw>(ch_ctx.pub))
     ctx_.raise(loc_).Error("Register publish type for topic [{}] failed.", topic_name);
 
+  // 取出可能的进程内信道，同一话题的发布者与订阅者须使用同一种用户类型
+  ch_ctx.intra = details::IntraProcessBus::Instance().Find(topic_name);
+  if (ch_ctx.intra != nullptr and not ch_ctx.intra->BindType(typeid(T)))
+    ctx_.raise(loc_).Error("Intra-process topic [{}] is used with different types.", topic_name);
+
   // 初始化成功，维护该发布器资源
   ctx_.channel_contexts_.push_back(std::move(ch_ctx));
   ctx_.log(loc_).Info("Init publisher for topic [{}] succeeded.", topic_name);
@@ -113,6 +193,12 @@ std::pair<res::Channel<T>, Context::ChannelContext&> Context::OpPub::DoInit(cons
 
 template <concepts::DirectlySupportedType T>
 Context::PublishFunction<T> Context::OpPub::CreatePublishFunction()
+{
+  return CreateRawPublishFunction<T>();
+}
+
+template <concepts::DirectlySupportedType T>
+Context::RawPublishFunction<T> Context::OpPub::CreateRawPublishFunction()
 {
   return
     [](aimrt::channel::PublisherRef pub, aimrt::channel::ContextRef ch_ctx, const T& msg) {
@@ -120,18 +206,102 @@ Context::PublishFunction<T> Context::OpPub::CreatePublishFunction()
   };
 }
 
+template <class T, concepts::ByConverter TConverter, bool kReuseBuffer>
+void Context::OpPub::SetConvertedPublishFunctions(ChannelContext& pub_ctx)
+{
+  const RawPublishFunction<T> raw_pub_f =
+    [](aimrt::channel::PublisherRef pub, aimrt::channel::ContextRef ch_ctx, const T& src_msg) {
+      ConvertAndPublish<T, TConverter, kReuseBuffer>(pub, ch_ctx, src_msg);
+    };
 
-template <class T, concepts::ByConverter TConverter>
-Context::PublishFunction<T> Context::OpPub::CreatePublishFunction()
+  const RawPublishMovedFunction<T> raw_pub_moved_f =
+    [](aimrt::channel::PublisherRef pub, aimrt::channel::ContextRef ch_ctx, T&& src_msg) {
+      ConvertAndPublish<T, TConverter, kReuseBuffer>(pub, ch_ctx, std::move(src_msg));
+    };
+
+  pub_ctx.pub_f           = PublishFunction<T>(raw_pub_f);
+  pub_ctx.raw_pub_f       = raw_pub_f;
+  pub_ctx.raw_pub_moved_f = raw_pub_moved_f;
+}
+
+template <class T>
+void Context::OpPub::SetIntraProcessPublishFunction(ChannelContext& pub_ctx)
+{
+  pub_ctx.pub_f = PublishFunction<T>(
+    [intra = pub_ctx.intra](aimrt::channel::PublisherRef, aimrt::channel::ContextRef, const T& msg) {
+      intra->Publish(std::make_shared<const T>(msg));
+    });
+
+  // 不再提供原生的发布函数，发布句柄将退回到上下文查找的发布过程
+  pub_ctx.raw_pub_f.reset();
+  pub_ctx.raw_pub_moved_f.reset();
+}
+
+template <class T, concepts::ByConverter TConverter, bool kReuseBuffer, class TSrc>
+void Context::OpPub::ConvertAndPublish(
+  aimrt::channel::PublisherRef pub, aimrt::channel::ContextRef ch_ctx, TSrc&& src_msg)
 {
   using TMsg = typename TConverter::AnotherType;
 
-  return
-    [](aimrt::channel::PublisherRef pub, aimrt::channel::ContextRef ch_ctx, const T& src_msg) {
+  const auto convert_and_publish = [&](TMsg& dst_msg) {
+    if constexpr (std::is_rvalue_reference_v<TSrc&&>) {
+      constexpr auto cvt = TConverter::template FromOriginalMoved<T>();
+      cvt(std::move(src_msg), dst_msg);
+    } else {
       constexpr auto cvt = TConverter::template FromOriginal<T>();
-      TMsg dst_msg;
       cvt(src_msg, dst_msg);
-      aimrt::channel::Publish(pub, ch_ctx, dst_msg);
+    }
+
+    aimrt::channel::Publish(pub, ch_ctx, dst_msg);
   };
+
+  if constexpr (kReuseBuffer) {
+    details::ThreadLocalBuffer<TMsg>::Use(convert_and_publish);
+  } else {
+    TMsg dst_msg;
+    convert_and_publish(dst_msg);
+  }
 }
+
+template <class T>
+void Context::PublishHandle<T>::Publish(const T& msg) const
+{
+  aimrt::channel::Context ch_ctx;
+  Publish(ch_ctx, msg);
+}
+
+template <class T>
+void Context::PublishHandle<T>::Publish(aimrt::channel::ContextRef ch_ctx, const T& msg) const
+{
+  // 若允许 trace，则为 channel 上下文添加相关信息，确保 trace 被启动
+  if (enable_trace_) [[unlikely]]
+    OpPub::StartTrace(ch_ctx);
+
+  // 直接调用未擦除类型的发布函数
+  pub_f_(pub_, ch_ctx, msg);
+}
+
+template <class T>
+void Context::PublishHandle<T>::Publish(T&& msg) const
+{
+  aimrt::channel::Context ch_ctx;
+  Publish(ch_ctx, std::move(msg));
+}
+
+template <class T>
+void Context::PublishHandle<T>::Publish(aimrt::channel::ContextRef ch_ctx, T&& msg) const
+{
+  // 没有移入数据的发布函数时，与常引用版本相同
+  if (pub_moved_f_ == nullptr) {
+    Publish(ch_ctx, static_cast<const T&>(msg));
+    return;
+  }
+
+  // 若允许 trace，则为 channel 上下文添加相关信息，确保 trace 被启动
+  if (enable_trace_) [[unlikely]]
+    OpPub::StartTrace(ch_ctx);
+
+  // 直接调用未擦除类型的发布函数
+  pub_moved_f_(pub_, ch_ctx, std::move(msg));
 }
+}  // namespace aimrte::core
@@ -47,7 +47,7 @@ res::Service<Q, P> Context::OpSrv::InitMock(const std::string_view& service_name
         ctx_ptr->exe(exe).Post(
           [&server, rpc_ctx{std::move(rpc_ctx)}, q{std::move(q)}, analyzer{std::move(analyzer)}]() -> co::Task<void> {
             // 设置 rpc context（其余内容已经在 exe 中设置）
-            details::g_thread_ctx.active_rpc_context = rpc_ctx;
+            details::g_thread_ctx = {details::g_thread_ctx->ctx_ptr, details::g_thread_ctx->exe, rpc_ctx};
 
             // 调用用户设置的回调
             P p;
@@ -77,14 +77,14 @@ res::Service<Q, P> Context::OpSrv::InitService(res::Service<QRaw, PRaw>&& srv)
 
   // 若当前服务资源已经被绑定了服务处理函数，则报错
   if (srv_ctx.serve_f.has_value())
-    ctx_.raise(loc_).Error("Init service [{}] failed, because a user server is set.", srv.name_);
+    ctx_.raise(loc_).Error("Init service [{}] failed, because a user server is set.", srv.GetName());
 
   // 重新绑定服务的处理过程，以植入类型转换过程。
   srv_ctx.server_invoke_f = CreateServerInvokerFunction<Q, P, QCvt, PCvt>();
 
   // 准备新的资源标识符
   res::Service<Q, P> new_srv;
-  new_srv.name_       = std::move(srv.name_);
+  new_srv.name_       = srv.name_;
   new_srv.idx_        = srv.idx_;
   new_srv.context_id_ = ctx_.id_;
 
@@ -225,14 +225,14 @@ template <class Q, class P, concepts::SupportedServer<Q, P> TServer>
 void Context::OpSrv::DoServe(const res::Service<Q, P>& srv, TServer server, res::Executor exe)
 {
   const std::string exe_msg =
-    exe.IsValid() ? ::fmt::format("on executor [{}]", exe.name_) : "inline";
+    exe.IsValid() ? ::fmt::format("on executor [{}]", exe.GetName()) : "inline";
 
   // 取出服务上下文
   ServiceContext& srv_ctx = ctx_.GetServiceContext(srv, loc_);
 
   // 若服务已经被绑定，则报错
   if (srv_ctx.serve_f.has_value())
-    ctx_.raise(loc_).Error("Serve [{}] {} failed. You CANNOT serve twice on the same res::Service !", srv.name_, exe_msg);
+    ctx_.raise(loc_).Error("Serve [{}] {} failed. You CANNOT serve twice on the same res::Service !", srv.GetName(), exe_msg);
 
   // 标准化服务处理函数
   auto cb = StandardizeServer<Q, P>(std::move(server));
@@ -243,7 +243,7 @@ void Context::OpSrv::DoServe(const res::Service<Q, P>& srv, TServer server, res:
       std::move(cb), ctx_.weak_from_this(), std::move(exe));
 
     // 绑定服务成功
-    ctx_.log(loc_).Info("Serve [{}] {} succeeded.", srv.name_, exe_msg);
+    ctx_.log(loc_).Info("Serve [{}] {} succeeded.", srv.GetName(), exe_msg);
     return;
   }
 
@@ -281,7 +281,7 @@ void Context::OpSrv::DoServe(const res::Service<Q, P>& srv, TServer server, res:
   }
 
   // 绑定服务成功
-  ctx_.log(loc_).Info("Serve [{}] {} succeeded.", srv.name_, exe_msg);
+  ctx_.log(loc_).Info("Serve [{}] {} succeeded.", srv.GetName(), exe_msg);
 }
 
 template <concepts::DirectlySupportedType Q, concepts::DirectlySupportedType P> Context::ServerInvoker<Q, P>
@@ -14,10 +14,11 @@ class Context::OpSub : public OpBase
    * @brief 初始化指定通信类型与话题名称的订阅信道，并返回它的资源标识符。
    * @tparam T AimRT 支持的通信类型
    * @param topic_name 话题名称
+   * @param queue      订阅队列的默认配置，注册回调时未指定队列配置时使用
    * @return 信道资源标识符，将用于后续注册回调。
    */
   template <concepts::DirectlySupportedType T>
-  [[nodiscard]] res::Channel<T> Init(const std::string_view& topic_name);
+  [[nodiscard]] res::Channel<T> Init(const std::string_view& topic_name, const QueueOption& queue = {});
 
   /**
    * @brief 在给定通信类型适配器的情况下，初始化指定用户类型与话题名称的订阅信道，
@@ -25,10 +26,11 @@ class Context::OpSub : public OpBase
    * @tparam T          用户自定义类型
    * @tparam TConverter 用于转换用户类型到通信类型的转化器，其中定义了通信类型
    * @param topic_name  话题名称
+   * @param queue       订阅队列的默认配置，注册回调时未指定队列配置时使用
    * @return 信道资源标识符，将用于后续注册回调。
    */
   template <class T, concepts::ByConverter TConverter>
-  [[nodiscard]] res::Channel<T> Init(const std::string_view& topic_name);
+  [[nodiscard]] res::Channel<T> Init(const std::string_view& topic_name, const QueueOption& queue = {});
 
   /**
    * @brief 初始化一个被测的订阅通道资源
@@ -43,7 +45,13 @@ class Context::OpSub : public OpBase
    *                 将在原生通信的回调中执行，请勿编写过重的内容。
    */
   template <class T, concepts::SupportedSubscriber<T> TCallback>
-  void SubscribeInline(const res::Channel<T>& ch, TCallback callback);
+  void SubscribeInline(const res::Channel<T>& ch, TCallback callback, const SubscribeOption& option = {});
+
+  /**
+   * @return 指定信道资源的订阅统计数据
+   */
+  template <class T>
+  [[nodiscard]] SubscribeStats GetStats(const res::Channel<T>& ch);
 
  private:
   /**
@@ -52,10 +60,11 @@ class Context::OpSub : public OpBase
    * @tparam T 使用时的类型
    * @tparam TRaw 用于通信的类型。
    * @param topic_name 信道话题名称
+   * @param queue      订阅队列的默认配置
    * @return 新的 channel 资源描述符，以及初始化了部分内容的信道上下文。
    */
   template <class T, concepts::DirectlySupportedType TRaw = T>
-  std::pair<res::Channel<T>, ChannelContext&> DoInit(const std::string_view& topic_name);
+  std::pair<res::Channel<T>, ChannelContext&> DoInit(const std::string_view& topic_name, const QueueOption& queue);
 
   /**
    * @brief 向原生订阅器，注册回调函数，将区分是否在 exectuor 上，设置不同的过程。
@@ -65,10 +74,43 @@ class Context::OpSub : public OpBase
    * @param ctx_weak_ptr 本模块的上下文，将用于回调函数执行前的环境准备
    * @param callback     用户的回调协程
    * @param exe          可能的执行器资源，若资源不可用，将设置 inline 模式回调。
+   * @param option       订阅的可选配置
+   * @param counter      订阅的统计计数器
    * @return 是否注册成功
    */
   template <concepts::DirectlySupportedType T, concepts::SubscriberCoroutine<T> F>
-  static bool RawSubscribe(aimrt::channel::SubscriberRef subscriber, std::weak_ptr<Context> ctx_weak_ptr, res::Executor exe, F callback);
+  static bool RawSubscribe(
+    aimrt::channel::SubscriberRef subscriber, std::weak_ptr<Context> ctx_weak_ptr, res::Executor exe, F callback,
+    const SubscribeOption& option, std::shared_ptr<details::SubscribeCounter> counter);
+
+  /**
+   * @brief 向进程内信道注册回调函数，与 RawSubscribe 类似，区分是否在 exectuor 上，设置不同的过程，
+   *        但消息为发布者共享的对象，不再经过反序列化与类型转换。
+   * @tparam T 用户类型
+   * @tparam F 标准化的回调协程
+   */
+  template <class T, class F>
+  static void IntraSubscribe(
+    details::IntraProcessTopic& topic, F callback, std::weak_ptr<Context> ctx_weak_ptr, res::Executor exe,
+    const SubscribeOption& option, std::shared_ptr<details::SubscribeCounter> counter);
+
+  /**
+   * @brief 池化模式下，在执行器上分发一条消息的协程。回调函数被共享持有，不会被复制。
+   */
+  template <class T, class F>
+  static co::Task<void> Dispatch(std::shared_ptr<F> callback, std::shared_ptr<const T> msg);
+
+  /**
+   * @brief 合并模式下，在执行器上处理槽位中最新消息的协程，直到槽位为空且没有新消息到来。
+   */
+  template <class T, class F>
+  static co::Task<void> DrainConflated(std::shared_ptr<F> callback, std::shared_ptr<details::ConflateSlot<T>> slot);
+
+  /**
+   * @brief 有界队列模式下，在执行器上按序处理队列中消息的协程，直到队列为空。
+   */
+  template <class T, class F>
+  static co::Task<void> DrainQueue(std::shared_ptr<F> callback, std::shared_ptr<details::BoundedQueue<T>> queue);
 
   /**
    * @return 注册回调的函数
@@ -82,11 +124,26 @@ class Context::OpSub : public OpBase
   template <class T, concepts::ByConverter TConverter>
   static SubscribeFunction<T> CreateSubscribeFunction();
 
+  /**
+   * @return 用于存放转换后数据的对象，池化模式下，对象与控制块一同从内存池中分配
+   */
+  template <class T>
+  static std::shared_ptr<T> MakeConvertedMessage(bool pooled);
+
+  /**
+   * @brief 将原生消息转换为用户类型，按订阅配置，共享转换结果、或复用回收的目标对象。
+   * @param src  原生消息
+   * @param pool 转换结果的回收池，可能为空
+   */
+  template <class T, concepts::ByConverter TConverter, class TRaw>
+  static std::shared_ptr<const T> ConvertMessage(
+    const std::shared_ptr<const TRaw>& src, const SubscribeOption& option, details::ObjectPool<T>* pool);
+
   /**
    * @brief 统一的 channel 注册订阅过程。
    */
   template <class T, concepts::SupportedSubscriber<T> TCallback>
-  void DoSubscribe(const res::Channel<T>& ch, TCallback callback, res::Executor exe);
+  void DoSubscribe(const res::Channel<T>& ch, TCallback callback, res::Executor exe, SubscribeOption option);
 
   /**
    * @brief 标准化订阅函数为 co::Task<void>(std::shared_ptr<const T>)
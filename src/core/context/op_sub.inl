@@ -7,10 +7,10 @@
 namespace aimrte::core
 {
 template <concepts::DirectlySupportedType T>
-res::Channel<T> Context::OpSub::Init(const std::string_view& topic_name)
+res::Channel<T> Context::OpSub::Init(const std::string_view& topic_name, const QueueOption& queue)
 {
   // 以当前的类型，以及话题名称，创建新的信道上下文
-  auto [ch, ch_ctx] = DoInit<T>(topic_name);
+  auto [ch, ch_ctx] = DoInit<T>(topic_name, queue);
 
   // 基于该类型，设置发布函数与订阅函数
   ch_ctx.sub_f = CreateSubscribeFunction<T>();
@@ -20,12 +20,12 @@ res::Channel<T> Context::OpSub::Init(const std::string_view& topic_name)
 }
 
 template <class T, concepts::ByConverter TConverter>
-res::Channel<T> Context::OpSub::Init(const std::string_view& topic_name)
+res::Channel<T> Context::OpSub::Init(const std::string_view& topic_name, const QueueOption& queue)
 {
   using TRaw = typename TConverter::AnotherType;
 
   // 以当前的类型，以及话题名称，创建新的信道上下文
-  auto [ch, ch_ctx] = DoInit<T, TRaw>(topic_name);
+  auto [ch, ch_ctx] = DoInit<T, TRaw>(topic_name, queue);
 
   // 基于该类型，设置发布函数与订阅函数
   ch_ctx.sub_f = CreateSubscribeFunction<T, TConverter>();
@@ -42,7 +42,7 @@ res::Channel<T> Context::OpSub::InitMock(const std::string_view& topic_name, IMo
 
   // 使用 mock 接管订阅的过程，对被测订阅通道进行数据饲喂，驱动被测订阅者进行功能处理
   ch_ctx.sub_f = SubscribeFunction<T>(
-    [&mocker](auto, ChannelCallback<T> cb, std::weak_ptr<Context> ctx_ptr, res::Executor exe) -> bool {
+    [&mocker](auto, ChannelCallback<T> cb, std::weak_ptr<Context> ctx_ptr, res::Executor exe, const SubscribeOption&, auto) -> bool {
       mocker.cb_ = [cb, ctx_ptr{ctx_ptr}](T msg) {
         details::g_thread_ctx = {ctx_ptr};
         cb(std::make_shared<const T>(std::move(msg))).Sync();
@@ -72,13 +72,24 @@ res::Channel<T> Context::OpSub::InitMock(const std::string_view& topic_name, IMo
 }
 
 template <class T, concepts::SupportedSubscriber<T> TCallback>
-void Context::OpSub::SubscribeInline(const res::Channel<T>& ch, TCallback callback)
+void Context::OpSub::SubscribeInline(const res::Channel<T>& ch, TCallback callback, const SubscribeOption& option)
 {
-  DoSubscribe(ch, std::move(callback), {});
+  DoSubscribe(ch, std::move(callback), {}, option);
+}
+
+template <class T>
+SubscribeStats Context::OpSub::GetStats(const res::Channel<T>& ch)
+{
+  // 取出信道上下文，被 mock 接管的订阅没有统计数据
+  const ChannelContext& ch_ctx = ctx_.GetChannelContext(ch, loc_);
+  if (ch_ctx.sub_counter == nullptr)
+    return {};
+
+  return ch_ctx.sub_counter->Snapshot();
 }
 
 template <class T, concepts::DirectlySupportedType TRaw>
-std::pair<res::Channel<T>, Context::ChannelContext&> Context::OpSub::DoInit(const std::string_view& topic_name)
+std::pair<res::Channel<T>, Context::ChannelContext&> Context::OpSub::DoInit(const std::string_view& topic_name, const QueueOption& queue)
 
 {
   // 准备新的上下文
@@ -88,6 +99,18 @@ std::pair<res::Channel<T>, Context::ChannelContext&> Context::OpSub::DoInit(cons
   ch_ctx.sub = ctx_.core_.GetChannelHandle().GetSubscriber(topic_name);
   ctx_.check(ch_ctx.sub, loc_).ErrorThrow("Get subscribe for topic [{}] failed.", topic_name);
 
+  // 准备该订阅的统计计数器，并登记到进程级的监控中
+  ch_ctx.sub_counter = std::make_shared<details::SubscribeCounter>();
+  details::RegisterSubscribeCounter(std::string(topic_name), ch_ctx.sub_counter);
+
+  // 记录订阅队列的默认配置
+  ch_ctx.sub_queue = queue;
+
+  // 取出可能的进程内信道，同一话题的发布者与订阅者须使用同一种用户类型
+  ch_ctx.intra = details::IntraProcessBus::Instance().Find(topic_name);
+  if (ch_ctx.intra != nullptr and not ch_ctx.intra->BindType(typeid(T)))
+    ctx_.raise(loc_).Error("Intra-process topic [{}] is used with different types.", topic_name);
+
   // 初始化成功，维护该发布器资源
   ctx_.channel_contexts_.push_back(std::move(ch_ctx));
   ctx_.log(loc_).Info("Init subscriber for topic [{}] succeeded.", topic_name);
@@ -102,12 +125,126 @@ std::pair<res::Channel<T>, Context::ChannelContext&> Context::OpSub::DoInit(cons
 
 template <concepts::DirectlySupportedType T, concepts::SubscriberCoroutine<T> F>
 bool Context::OpSub::RawSubscribe(
-  aimrt::channel::SubscriberRef subscriber, std::weak_ptr<Context> ctx_weak_ptr, res::Executor exe, F callback){
+  aimrt::channel::SubscriberRef subscriber, std::weak_ptr<Context> ctx_weak_ptr, res::Executor exe, F callback,
+  const SubscribeOption& option, std::shared_ptr<details::SubscribeCounter> counter)
+{
+  // 设置在给定的执行器上、以合并的方式处理消息：仅保留最新的一条待处理消息，且至多存在一个处理任务。
+  if (exe.IsValid() and option.conflate) {
+    return subscriber.Subscribe(
+      details::GetMessageTypeSupport<T>(),
+      [callback     = std::make_shared<F>(std::move(callback)),
+       slot         = std::make_shared<details::ConflateSlot<T>>(),
+       counter      = std::move(counter),
+       ctx_weak_ptr = std::move(ctx_weak_ptr),
+       exe          = std::move(exe),
+       pooled       = option.pooled](
+        const aimrt_channel_context_base_t*, const void* msg_ptr, aimrt_function_base_t* release_callback_base) {
+        // 取出上下文数据
+        const std::shared_ptr ctx_ptr = ctx_weak_ptr.lock();
+
+        // 若上下文已经失效，忽略该数据
+        if (nullptr == ctx_ptr)
+          return;
+
+        // 替换掉尚未处理的旧消息
+        counter->received.fetch_add(1, std::memory_order_relaxed);
+
+        const bool replaced = slot->Put(
+          pooled
+            ? details::MakePooledSharedMessage<T>(msg_ptr, release_callback_base)
+            : details::MakeSharedMessage<T>(msg_ptr, release_callback_base));
+
+        if (replaced)
+          counter->dropped.fetch_add(1, std::memory_order_relaxed);
+
+        // 若没有正在进行的处理任务，则在指定的执行器中启动它
+        if (slot->TrySchedule()) {
+          ctx_ptr->exe(exe).Spawn(
+            [&]() {
+              return DrainConflated<T>(callback, slot);
+            });
+        }
+      });
+  }
+
+  // 设置在给定的执行器上、以有界队列的方式处理消息：队列满时按策略丢弃或阻塞，且至多存在一个处理任务。
+  // 阻塞的通信线程在模块被要求退出时，经由其退出令牌被唤醒
+  if (exe.IsValid() and option.queue.depth > 0) {
+    const std::shared_ptr owner = ctx_weak_ptr.lock();
+    if (nullptr == owner)
+      return false;
+
+    return subscriber.Subscribe(
+      details::GetMessageTypeSupport<T>(),
+      [callback     = std::make_shared<F>(std::move(callback)),
+       queue        = std::make_shared<details::BoundedQueue<T>>(option.queue, counter, owner->ShutdownToken()),
+       counter      = counter,
+       ctx_weak_ptr = std::move(ctx_weak_ptr),
+       exe          = std::move(exe),
+       pooled       = option.pooled](
+        const aimrt_channel_context_base_t*, const void* msg_ptr, aimrt_function_base_t* release_callback_base) {
+        // 若上下文已经失效，忽略该数据
+        if (ctx_weak_ptr.expired())
+          return;
+
+        counter->received.fetch_add(1, std::memory_order_relaxed);
+
+        // 放入队列，阻塞策略下，将在此处等待处理任务腾出空位
+        const bool schedule = queue->Put(
+          pooled
+            ? details::MakePooledSharedMessage<T>(msg_ptr, release_callback_base)
+            : details::MakeSharedMessage<T>(msg_ptr, release_callback_base));
+
+        if (not schedule)
+          return;
+
+        // 取出上下文数据
+        const std::shared_ptr ctx_ptr = ctx_weak_ptr.lock();
+
+        // 若上下文已经失效，忽略该数据
+        if (nullptr == ctx_ptr)
+          return;
+
+        // 在指定的执行器中启动处理任务
+        ctx_ptr->exe(exe).Spawn(
+          [&]() {
+            return DrainQueue<T>(callback, queue);
+          });
+      });
+  }
+
+  // 设置在给定的执行器上、以池化的方式分发消息：消息句柄的控制块来自内存池，
+  // 回调函数被共享持有，分发协程被直接启动，不再经过 Post 的包装。
+  if (exe.IsValid() and option.pooled) {
+    return subscriber.Subscribe(
+      details::GetMessageTypeSupport<T>(),
+      [callback     = std::make_shared<F>(std::move(callback)),
+       counter      = std::move(counter),
+       ctx_weak_ptr = std::move(ctx_weak_ptr),
+       exe          = std::move(exe)](
+        const aimrt_channel_context_base_t*, const void* msg_ptr, aimrt_function_base_t* release_callback_base) {
+        // 取出上下文数据
+        const std::shared_ptr ctx_ptr = ctx_weak_ptr.lock();
+
+        // 若上下文已经失效，忽略该数据
+        if (nullptr == ctx_ptr)
+          return;
+
+        counter->received.fetch_add(1, std::memory_order_relaxed);
+
+        // 在指定的执行器中回调处理
+        ctx_ptr->exe(exe).Spawn(
+          [&]() {
+            return Dispatch<T>(callback, details::MakePooledSharedMessage<T>(msg_ptr, release_callback_base));
+          });
+      });
+  }
+
   // 设置在给定的执行器上、订阅回调函数或协程的执行。
   if (exe.IsValid()) {
     return subscriber.Subscribe(
       details::GetMessageTypeSupport<T>(),
-      [callback = std::move(callback), ctx_weak_ptr = std::move(ctx_weak_ptr), exe = std::move(exe)](
+      [callback = std::move(callback), counter = std::move(counter), ctx_weak_ptr = std::move(ctx_weak_ptr), exe = std::move(exe)](
         const aimrt_channel_context_base_t*, const void* msg_ptr, aimrt_function_base_t* release_callback_base) {
         // 取出上下文数据
         const std::shared_ptr ctx_ptr = ctx_weak_ptr.lock();
@@ -116,6 +253,8 @@ bool Context::OpSub::RawSubscribe(
         if (nullptr == ctx_ptr)
           return;
 
+        counter->received.fetch_add(1, std::memory_order_relaxed);
+
         // 在指定的执行器中回调处理
         ctx_ptr->exe(exe).Post(
           [callback, msg = details::MakeSharedMessage<T>(msg_ptr, release_callback_base)]() mutable -> co::Task<void> {
@@ -127,16 +266,167 @@ bool Context::OpSub::RawSubscribe(
   // 设置在原生的通信回调中、执行用户订阅函数
   return subscriber.Subscribe(
     details::GetMessageTypeSupport<T>(),
-    [callback = std::move(callback), ctx_ptr = std::move(ctx_weak_ptr)](
+    [callback = std::move(callback), counter = std::move(counter), ctx_ptr = std::move(ctx_weak_ptr), pooled = option.pooled](
       const aimrt_channel_context_base_t*, const void* msg_ptr, aimrt_function_base_t* release_callback_base) {
+      counter->received.fetch_add(1, std::memory_order_relaxed);
+
       // 准备执行上下文
       details::g_thread_ctx = {ctx_ptr};
 
       // 唤起用户的回调
-      co::SyncInline(callback, details::MakeSharedMessage<T>(msg_ptr, release_callback_base));
+      co::SyncInline(
+        callback,
+        pooled
+          ? details::MakePooledSharedMessage<T>(msg_ptr, release_callback_base)
+          : details::MakeSharedMessage<T>(msg_ptr, release_callback_base));
     });
 }
 
+template <class T, class F>
+void Context::OpSub::IntraSubscribe(
+  details::IntraProcessTopic& topic, F callback, std::weak_ptr<Context> ctx_weak_ptr, res::Executor exe,
+  const SubscribeOption& option, std::shared_ptr<details::SubscribeCounter> counter)
+{
+  // 设置在给定的执行器上、以合并的方式处理共享的消息
+  if (exe.IsValid() and option.conflate) {
+    topic.Subscribe(
+      [callback     = std::make_shared<F>(std::move(callback)),
+       slot         = std::make_shared<details::ConflateSlot<T>>(),
+       counter      = std::move(counter),
+       ctx_weak_ptr = std::move(ctx_weak_ptr),
+       exe          = std::move(exe)](const std::shared_ptr<const void>& msg) {
+        // 取出上下文数据
+        const std::shared_ptr ctx_ptr = ctx_weak_ptr.lock();
+
+        // 若上下文已经失效，忽略该数据
+        if (nullptr == ctx_ptr)
+          return;
+
+        // 替换掉尚未处理的旧消息
+        counter->received.fetch_add(1, std::memory_order_relaxed);
+
+        if (slot->Put(std::static_pointer_cast<const T>(msg)))
+          counter->dropped.fetch_add(1, std::memory_order_relaxed);
+
+        // 若没有正在进行的处理任务，则在指定的执行器中启动它
+        if (slot->TrySchedule()) {
+          ctx_ptr->exe(exe).Spawn(
+            [&]() {
+              return DrainConflated<T>(callback, slot);
+            });
+        }
+      });
+
+    return;
+  }
+
+  // 设置在给定的执行器上、以有界队列的方式处理共享的消息
+  if (exe.IsValid() and option.queue.depth > 0) {
+    const std::shared_ptr owner = ctx_weak_ptr.lock();
+    if (nullptr == owner)
+      return;
+
+    topic.Subscribe(
+      [callback     = std::make_shared<F>(std::move(callback)),
+       queue        = std::make_shared<details::BoundedQueue<T>>(option.queue, counter, owner->ShutdownToken()),
+       counter      = counter,
+       ctx_weak_ptr = std::move(ctx_weak_ptr),
+       exe          = std::move(exe)](const std::shared_ptr<const void>& msg) {
+        // 若上下文已经失效，忽略该数据
+        if (ctx_weak_ptr.expired())
+          return;
+
+        counter->received.fetch_add(1, std::memory_order_relaxed);
+
+        // 放入队列，阻塞策略下，将在此处阻塞发布者
+        if (not queue->Put(std::static_pointer_cast<const T>(msg)))
+          return;
+
+        // 取出上下文数据
+        const std::shared_ptr ctx_ptr = ctx_weak_ptr.lock();
+
+        // 若上下文已经失效，忽略该数据
+        if (nullptr == ctx_ptr)
+          return;
+
+        // 在指定的执行器中启动处理任务
+        ctx_ptr->exe(exe).Spawn(
+          [&]() {
+            return DrainQueue<T>(callback, queue);
+          });
+      });
+
+    return;
+  }
+
+  // 设置在给定的执行器上、处理共享的消息
+  if (exe.IsValid()) {
+    topic.Subscribe(
+      [callback     = std::make_shared<F>(std::move(callback)),
+       counter      = std::move(counter),
+       ctx_weak_ptr = std::move(ctx_weak_ptr),
+       exe          = std::move(exe)](const std::shared_ptr<const void>& msg) {
+        // 取出上下文数据
+        const std::shared_ptr ctx_ptr = ctx_weak_ptr.lock();
+
+        // 若上下文已经失效，忽略该数据
+        if (nullptr == ctx_ptr)
+          return;
+
+        counter->received.fetch_add(1, std::memory_order_relaxed);
+
+        // 在指定的执行器中回调处理
+        ctx_ptr->exe(exe).Spawn(
+          [&]() {
+            return Dispatch<T>(callback, std::static_pointer_cast<const T>(msg));
+          });
+      });
+
+    return;
+  }
+
+  // 设置在发布者的线程中、执行用户订阅函数
+  topic.Subscribe(
+    [callback = std::move(callback), counter = std::move(counter), ctx_weak_ptr = std::move(ctx_weak_ptr)](
+      const std::shared_ptr<const void>& msg) {
+      // 若上下文已经失效，忽略该数据
+      if (ctx_weak_ptr.expired())
+        return;
+
+      counter->received.fetch_add(1, std::memory_order_relaxed);
+
+      // 准备执行上下文，并在结束后恢复发布者的上下文
+      const details::ThreadContext publisher_ctx = details::g_thread_ctx;
+      AIMRTE(defer(details::g_thread_ctx = publisher_ctx));
+      details::g_thread_ctx = {ctx_weak_ptr};
+
+      // 唤起用户的回调
+      co::SyncInline(callback, std::static_pointer_cast<const T>(msg));
+    });
+}
+
+template <class T, class F>
+co::Task<void> Context::OpSub::Dispatch(std::shared_ptr<F> callback, std::shared_ptr<const T> msg)
+{
+  co_return co_await (*callback)(std::move(msg));
+}
+
+template <class T, class F>
+co::Task<void> Context::OpSub::DrainConflated(std::shared_ptr<F> callback, std::shared_ptr<details::ConflateSlot<T>> slot)
+{
+  do {
+    while (std::shared_ptr<const T> msg = slot->Take())
+      co_await (*callback)(std::move(msg));
+  } while (slot->Reschedule());
+}
+
+template <class T, class F>
+co::Task<void> Context::OpSub::DrainQueue(std::shared_ptr<F> callback, std::shared_ptr<details::BoundedQueue<T>> queue)
+{
+  while (std::shared_ptr<const T> msg = queue->Take())
+    co_await (*callback)(std::move(msg));
+}
+
 template <concepts::DirectlySupportedType T>
 Context::SubscribeFunction<T> Context::OpSub::CreateSubscribeFunction()
 {
@@ -145,8 +435,10 @@ Context::SubscribeFunction<T> Context::OpSub::CreateSubscribeFunction()
       aimrt::channel::SubscriberRef sub,
       ChannelCallback<T> cb,
       std::weak_ptr<Context> ctx_ptr,
-      res::Executor exe) -> bool {
-      return RawSubscribe<T>(sub, std::move(ctx_ptr), std::move(exe), std::move(cb));
+      res::Executor exe,
+      const SubscribeOption& option,
+      std::shared_ptr<details::SubscribeCounter> counter) -> bool {
+      return RawSubscribe<T>(sub, std::move(ctx_ptr), std::move(exe), std::move(cb), option, std::move(counter));
     };
 }
 
@@ -160,39 +452,89 @@ Context::SubscribeFunction<T> Context::OpSub::CreateSubscribeFunction()
       aimrt::channel::SubscriberRef sub,
       ChannelCallback<T> cb,
       std::weak_ptr<Context> ctx_ptr,
-      res::Executor exe) -> bool {
+      res::Executor exe,
+      const SubscribeOption& option,
+      std::shared_ptr<details::SubscribeCounter> counter) -> bool {
+      // 按需创建本订阅的转换结果回收池
+      std::shared_ptr<details::ObjectPool<T>> pool;
+      if (option.recycle_converted > 0)
+        pool = std::make_shared<details::ObjectPool<T>>(option.recycle_converted);
+
       return RawSubscribe<TMsg>(
         sub, std::move(ctx_ptr), std::move(exe),
-        [cb = std::move(cb)](std::shared_ptr<const TMsg> src_msg) -> co::Task<void> {
-          constexpr auto cvt = TConverter::template ToOriginal<T>();
-          auto dst_msg       = std::make_shared<T>();
-          cvt(*src_msg, *dst_msg);
-          co_return co_await cb(std::move(dst_msg));
-        });
+        [cb = std::move(cb), option, pool = std::move(pool)](std::shared_ptr<const TMsg> src_msg) -> co::Task<void> {
+          co_return co_await cb(ConvertMessage<T, TConverter>(src_msg, option, pool.get()));
+        },
+        option, std::move(counter));
   };
 }
 
-template <class T, concepts::SupportedSubscriber<T> TCallback>
-void Context::OpSub::DoSubscribe(const res::Channel<T> &ch, TCallback callback, res::Executor exe)
+template <class T>
+std::shared_ptr<T> Context::OpSub::MakeConvertedMessage(const bool pooled)
 {
-  const std::string exe_msg =
-    exe.IsValid() ? ::fmt::format("on executor [{}]", exe.name_) : "inline";
+  // 超出默认对齐要求的类型（如部分 Eigen 类型）无法使用内存池
+  if constexpr (alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__) {
+    if (pooled)
+      return std::allocate_shared<T>(details::PoolAllocator<T>());
+  }
+
+  return std::make_shared<T>();
+}
+
+template <class T, concepts::ByConverter TConverter, class TRaw>
+std::shared_ptr<const T> Context::OpSub::ConvertMessage(
+  const std::shared_ptr<const TRaw>& src, const SubscribeOption& option, details::ObjectPool<T>* pool)
+{
+  const auto convert = [&]() -> std::shared_ptr<T> {
+    constexpr auto cvt     = TConverter::template ToOriginal<T>();
+    std::shared_ptr<T> dst = pool != nullptr ? pool->Acquire() : MakeConvertedMessage<T>(option.pooled);
+    cvt(*src, *dst);
+    return dst;
+  };
 
+  if (option.share_converted)
+    return details::ConvertCache<TRaw, T, TConverter>::Instance().GetOrConvert(src, convert);
+
+  return convert();
+}
+
+template <class T, concepts::SupportedSubscriber<T> TCallback>
+void Context::OpSub::DoSubscribe(const res::Channel<T> &ch, TCallback callback, res::Executor exe, SubscribeOption option)
+{
   // 取出信道上下文
   ChannelContext& ch_ctx = ctx_.GetChannelContext(ch, loc_);
 
+  // 未指定队列配置时，使用信道初始化时给定的默认配置
+  if (option.queue.depth == 0)
+    option.queue = ch_ctx.sub_queue;
+
+  const std::string exe_msg =
+    (exe.IsValid() ? ::fmt::format("on executor [{}]", exe.GetName()) : "inline") +
+    (option.pooled ? " (pooled)" : "") + (option.conflate ? " (conflate)" : "") +
+    (option.queue.depth > 0 ? ::fmt::format(" (queue {})", option.queue.depth) : "") +
+    (ch_ctx.intra != nullptr ? " (intra-process)" : "");
+
+  // 进程内通信的话题，直接在进程内信道上注册，跳过原生通信与类型转换
+  if (ch_ctx.intra != nullptr) {
+    IntraSubscribe<T>(
+      *ch_ctx.intra, StandardizeSubscriber<T>(std::move(callback)), ctx_.weak_from_this(), std::move(exe), option, ch_ctx.sub_counter);
+
+    ctx_.log(loc_).Info("Subscribe [{}] {} succeeded.", ch.GetName(), exe_msg);
+    return;
+  }
+
   // 取出该资源类型的注册函数
   SubscribeFunction<T>& sub_f = std::any_cast<SubscribeFunction<T>&>(ch_ctx.sub_f);
 
   // 执行注册
   const bool ret =
-    sub_f(ch_ctx.sub, StandardizeSubscriber<T>(std::move(callback)), ctx_.weak_from_this(), std::move(exe));
+    sub_f(ch_ctx.sub, StandardizeSubscriber<T>(std::move(callback)), ctx_.weak_from_this(), std::move(exe), option, ch_ctx.sub_counter);
 
   // 处理结果
   if (ret)
-    ctx_.log(loc_).Info("Subscribe [{}] {} succeeded.", ch.name_, exe_msg);
+    ctx_.log(loc_).Info("Subscribe [{}] {} succeeded.", ch.GetName(), exe_msg);
   else
-    ctx_.raise(loc_).Error("Subscribe [{}] {} failed.", ch.name_, exe_msg);
+    ctx_.raise(loc_).Error("Subscribe [{}] {} failed.", ch.GetName(), exe_msg);
 }
 
 template <class T, concepts::SupportedSubscriber<T> F>
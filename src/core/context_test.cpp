@@ -7,6 +7,9 @@
 #include "src/trait/trait.h"
 #include "src/test_protocol/TestService.h"
 #include "Eigen/Eigen"
+#include <array>
+#include <future>
+#include <semaphore>
 
 // 实现协议数据类型（test_protocol::TestMsg）与自定义类型（std::string）的转换函数，
 // 可用于封装通信接口
@@ -50,6 +53,8 @@ aimrt:
         type: asio_thread
         options:
           thread_num: 5 # 线程数，不指定则默认单线程
+      - name: priority_thread # 按优先级调度的单线程
+        type: priority_thread
   channel: # 消息队列相关配置
     backends: # 消息队列后端配置
       - type: local # 本地消息队列配置
@@ -191,6 +196,334 @@ TEST_F(ContextTest, GetExecutorAndPost)
   std::this_thread::sleep_for(std::chrono::seconds(1));
 }
 
+TEST_F(ContextTest, TimerWheelSleep)
+{
+  core::EnableTimerWheel("work_thread_pool", std::chrono::milliseconds(1));
+  AIMRTE(defer(core::EnableTimerWheel("work_thread_pool", {})));
+
+  ctrl.LetStart();
+
+  core::Context& ctx = ctrl.GetContext();
+  res::Executor res  = ctx.InitExecutor("work_thread_pool");
+
+  core::details::TimerWheel* wheel = core::Context::OpExe::GetTimerWheel(ctx.exe(res));
+  GTEST_ASSERT_NE(wheel, nullptr);
+
+  // 一半的协程睡眠不足 64 个 tick ，位于最底层；另一半超过 64 个 tick ，须从高层的槽位逐级下放
+  constexpr int kSleepers = 1000;
+  std::atomic_int started = 0;
+  std::atomic_int done    = 0;
+  std::atomic_int early   = 0;
+
+  for (int i = 0; i < kSleepers; ++i) {
+    ctx.exe(res).Post(
+      [&, i]() -> co::Task<void> {
+        const auto duration = i % 2 == 0 ? std::chrono::milliseconds(10 + i % 50) : std::chrono::milliseconds(200 + i % 300);
+        const auto begin    = std::chrono::steady_clock::now();
+
+        started.fetch_add(1);
+        co_await ctx::Sleep(duration);
+
+        if (std::chrono::steady_clock::now() - begin < duration)
+          early.fetch_add(1);
+        done.fetch_add(1);
+      });
+  }
+
+  for (int i = 0; i < 100 and started.load() < kSleepers; ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+  // ctx::Sleep 应当经由时间轮，此时较长的睡眠都还未到期，它们挂在时间轮上
+  GTEST_ASSERT_EQ(started.load(), kSleepers);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  GTEST_ASSERT_GE(wheel->Size(), static_cast<std::size_t>(kSleepers / 2));
+
+  // 周期循环同样经由时间轮睡眠
+  constexpr int kIterations   = 20;
+  std::atomic_int iterations  = 0;
+  std::atomic_bool loop_early = false;
+  std::atomic_bool loop_done  = false;
+
+  ctx.exe(res).Post(
+    [&]() -> co::Task<void> {
+      constexpr auto kPeriod = std::chrono::milliseconds(5);
+      ctx::Loop loop(kPeriod);
+
+      const auto begin = std::chrono::steady_clock::now();
+      while (iterations.load() < kIterations) {
+        const bool ok = co_await loop.Ok();
+        if (not ok)
+          break;
+
+        iterations.fetch_add(1);
+      }
+
+      // 首次调用立即返回，之后每次调用睡眠一个周期
+      if (std::chrono::steady_clock::now() - begin < (kIterations - 1) * kPeriod)
+        loop_early = true;
+
+      loop_done = true;
+    });
+
+  for (int i = 0; i < 200 and (done.load() < kSleepers or not loop_done.load()); ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  GTEST_ASSERT_EQ(done.load(), kSleepers);
+  GTEST_ASSERT_EQ(early.load(), 0);
+  GTEST_ASSERT_TRUE(loop_done.load());
+  GTEST_ASSERT_EQ(iterations.load(), kIterations);
+  GTEST_ASSERT_FALSE(loop_early.load());
+  GTEST_ASSERT_EQ(wheel->Size(), 0);
+}
+
+TEST_F(ContextTest, TimerWheelCancel)
+{
+  core::EnableTimerWheel("work_thread_pool", std::chrono::milliseconds(1));
+  AIMRTE(defer(core::EnableTimerWheel("work_thread_pool", {})));
+
+  ctrl.LetStart();
+
+  core::Context& ctx = ctrl.GetContext();
+  res::Executor res  = ctx.InitExecutor("work_thread_pool");
+
+  core::details::TimerWheel* wheel = core::Context::OpExe::GetTimerWheel(ctx.exe(res));
+  GTEST_ASSERT_NE(wheel, nullptr);
+
+  struct CountedNode : core::details::TimerWheel::Node {
+    std::atomic_int* fired = nullptr;
+  };
+
+  constexpr int kNodes  = 200;
+  std::atomic_int fired = 0;
+  std::vector<CountedNode> nodes(kNodes);
+
+  // 时长跨越最底层的 64 个 tick ，使部分节点位于高层槽位中
+  for (int i = 0; i < kNodes; ++i) {
+    nodes[i].fired    = &fired;
+    nodes[i].callback = [](core::details::TimerWheel::Node* node) {
+      static_cast<CountedNode*>(node)->fired->fetch_add(1);
+    };
+
+    wheel->Schedule(&nodes[i], std::chrono::milliseconds(20 + i % 100));
+  }
+
+  // 撤销偶数号的节点，已撤销的节点不能再次撤销
+  int cancelled = 0;
+  for (int i = 0; i < kNodes; i += 2) {
+    if (wheel->Cancel(&nodes[i]))
+      ++cancelled;
+  }
+
+  GTEST_ASSERT_EQ(cancelled, kNodes / 2);
+  GTEST_ASSERT_FALSE(wheel->Cancel(&nodes[0]));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(300));
+  GTEST_ASSERT_EQ(fired.load(), kNodes / 2);
+
+  // 已经到期的节点不能撤销
+  GTEST_ASSERT_FALSE(wheel->Cancel(&nodes[1]));
+}
+
+TEST_F(ContextTest, PriorityPost)
+{
+  ctrl.LetStart();
+
+  core::Context& ctx = ctrl.GetContext();
+  res::Executor res  = ctx.InitExecutor("priority_thread");
+
+  std::promise<void> release;
+  std::promise<void> blocked;
+  std::shared_future<void> release_future = release.get_future().share();
+
+  std::mutex mutex;
+  std::vector<core::Priority> order;
+  std::atomic_int done = 0;
+
+  // 先占住唯一的工作线程，使后续任务都在队列中排队
+  ctx.exe(res).Post(
+    [&]() {
+      blocked.set_value();
+      release_future.wait();
+    });
+  blocked.get_future().wait();
+
+  constexpr int kTasks = 10;
+  for (int i = 0; i < kTasks; ++i) {
+    const core::Priority prio = i % 2 == 0 ? core::Priority::Low : core::Priority::High;
+    ctx.exe(res).Post(
+      prio,
+      [&, prio]() {
+        const std::lock_guard lock(mutex);
+        order.push_back(prio);
+        done.fetch_add(1);
+      });
+  }
+
+  release.set_value();
+
+  for (int i = 0; i < 100 and done.load() < kTasks; ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  GTEST_ASSERT_EQ(done.load(), kTasks);
+  GTEST_ASSERT_TRUE(std::is_sorted(order.begin(), order.end(), std::greater<>()));
+  GTEST_ASSERT_EQ(order.front(), core::Priority::High);
+}
+
+TEST_F(ContextTest, PriorityPostNested)
+{
+  ctrl.LetStart();
+
+  core::Context& ctx = ctrl.GetContext();
+  res::Executor res  = ctx.InitExecutor("priority_thread");
+
+  std::mutex mutex;
+  std::vector<std::string> order;
+  std::atomic_int done = 0;
+
+  const auto record = [&](std::string name) {
+    const std::lock_guard lock(mutex);
+    order.push_back(std::move(name));
+    done.fetch_add(1);
+  };
+
+  // 高优先级任务中未指定优先级的投递，使用默认优先级，排在其后以高优先级投递的任务之后
+  ctx.exe(res).Post(
+    core::Priority::High,
+    [&]() {
+      ctx.exe(res).Post([&]() { record("nested"); });
+      ctx.exe(res).Post(core::Priority::High, [&]() { record("high"); });
+    });
+
+  for (int i = 0; i < 100 and done.load() < 2; ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  GTEST_ASSERT_EQ(done.load(), 2);
+  GTEST_ASSERT_EQ(order[0], "high");
+  GTEST_ASSERT_EQ(order[1], "nested");
+}
+
+TEST_F(ContextTest, ExecutorStats)
+{
+  // 统计计数器在进程内按执行器名称共享，以下仅比较增量
+  core::EnableExecutorStats("priority_thread");
+
+  ctrl.LetStart();
+
+  core::Context& ctx = ctrl.GetContext();
+  res::Executor res  = ctx.InitExecutor("priority_thread");
+
+  const auto find_stats = []() {
+    for (const core::NamedExecutorStats& one : core::CollectExecutorStats()) {
+      if (one.name == "priority_thread")
+        return one.stats;
+    }
+    return core::ExecutorStats{};
+  };
+
+  const core::ExecutorStats before = find_stats();
+
+  constexpr int kTasks = 100;
+  std::atomic_int done = 0;
+
+  for (int i = 0; i < kTasks; ++i) {
+    ctx.exe(res).Post(
+      [&]() {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+        done.fetch_add(1);
+      });
+  }
+
+  for (int i = 0; i < 100 and done.load() < kTasks; ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  GTEST_ASSERT_EQ(done.load(), kTasks);
+
+  // 最后一个任务计数后，仍需片刻记录其运行时间
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  const core::ExecutorStats after = find_stats();
+  GTEST_ASSERT_EQ(after.enqueued - before.enqueued, kTasks);
+  GTEST_ASSERT_EQ(after.executed - before.executed, kTasks);
+  GTEST_ASSERT_EQ(after.depth, 0);
+  GTEST_ASSERT_GT(after.max_depth, 1);
+  GTEST_ASSERT_GE(after.MeanRun(), std::chrono::microseconds(100));
+
+  // 投递到已被停止的 scope 中的任务不会被执行，但排队的计数仍应被归还
+  co::AsyncScope stopped_scope;
+  stopped_scope.Cancel();
+
+  bool ran = false;
+  ctx.exe(res).Post(
+    stopped_scope,
+    [&]() {
+      ran = true;
+    });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  const core::ExecutorStats dropped = find_stats();
+  GTEST_ASSERT_FALSE(ran);
+  GTEST_ASSERT_EQ(dropped.enqueued - after.enqueued, 1);
+  GTEST_ASSERT_EQ(dropped.dropped - after.dropped, 1);
+  GTEST_ASSERT_EQ(dropped.executed, after.executed);
+  GTEST_ASSERT_EQ(dropped.depth, 0);
+}
+
+TEST_F(ContextTest, ExecutorStatsSpawn)
+{
+  // 池化订阅的分发任务不经过 Post ，同样应当被统计
+  core::EnableExecutorStats("priority_thread");
+
+  ctrl.LetInit();
+  core::Context& ctx = ctrl.GetContext();
+
+  const res::Channel<test_protocol::TestMsg> res_pub =
+    ctx.pub().Init<test_protocol::TestMsg>("/my_topic_stats_pooled");
+
+  const res::Channel<test_protocol::TestMsg> res_sub =
+    ctx.sub().Init<test_protocol::TestMsg>("/my_topic_stats_pooled");
+
+  const res::Executor exe = ctx.InitExecutor("priority_thread");
+
+  const auto find_stats = []() {
+    for (const core::NamedExecutorStats& one : core::CollectExecutorStats()) {
+      if (one.name == "priority_thread")
+        return one.stats;
+    }
+    return core::ExecutorStats{};
+  };
+
+  constexpr int kMessages = 100;
+  std::atomic_int received = 0;
+
+  ctx.exe(exe).Subscribe(
+    res_sub,
+    [&](const test_protocol::TestMsg&) {
+      received.fetch_add(1);
+    },
+    {.pooled = true});
+
+  ctrl.LetStart();
+
+  const core::ExecutorStats before = find_stats();
+
+  test_protocol::TestMsg msg;
+  for (int i = 0; i < kMessages; ++i)
+    ctx.pub().Publish(res_pub, msg);
+
+  for (int i = 0; i < 100 and received.load() < kMessages; ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  // 最后一个任务计数后，仍需片刻记录其运行时间
+  std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  const core::ExecutorStats after = find_stats();
+  GTEST_ASSERT_EQ(received.load(), kMessages);
+  GTEST_ASSERT_EQ(after.enqueued - before.enqueued, kMessages);
+  GTEST_ASSERT_EQ(after.executed - before.executed, kMessages);
+  GTEST_ASSERT_EQ(after.depth, 0);
+}
+
 TEST_F(ContextTest, GetExecutorAndInline)
 {
   ctrl.LetInit();
@@ -235,6 +568,99 @@ TEST_F(ContextTest, Publish)
   ctx.pub().Publish(res2, str_msg);
 }
 
+TEST_F(ContextTest, PublishHandle)
+{
+  ctrl.LetInit();
+  core::Context& ctx = ctrl.GetContext();
+
+  // 同一模块不能在一个话题上重复注册同一类型的发布者，因此直接发布与转换后发布分别使用各自的话题
+  const res::Channel<test_protocol::TestMsg> res_pub =
+    ctx.pub().Init<test_protocol::TestMsg>("/my_topic_handle");
+
+  const res::Channel<std::string> res_pub_cvt =
+    ctx.pub().Init<std::string, convert::By<test_protocol::TestMsg>>("/my_topic_handle_cvt");
+
+  const res::Channel<test_protocol::TestMsg> res_sub =
+    ctx.sub().Init<test_protocol::TestMsg>("/my_topic_handle");
+
+  const res::Channel<test_protocol::TestMsg> res_sub_cvt =
+    ctx.sub().Init<test_protocol::TestMsg>("/my_topic_handle_cvt");
+
+  // 分别计数，确保两种句柄各自都送达了消息
+  std::atomic_int count     = 0;
+  std::atomic_int count_cvt = 0;
+
+  ctx.sub().SubscribeInline(
+    res_sub,
+    [&](const test_protocol::TestMsg& msg) {
+      if (msg.str() == "abc")
+        ++count;
+    });
+
+  ctx.sub().SubscribeInline(
+    res_sub_cvt,
+    [&](const test_protocol::TestMsg& msg) {
+      if (msg.str() == "abc")
+        ++count_cvt;
+    });
+
+  const core::Context::PublishHandle<test_protocol::TestMsg> handle = ctx.pub().Bind(res_pub);
+  const core::Context::PublishHandle<std::string> handle_cvt        = ctx.pub().Bind(res_pub_cvt);
+  GTEST_ASSERT_TRUE(handle.IsValid());
+  GTEST_ASSERT_TRUE(handle_cvt.IsValid());
+  GTEST_ASSERT_FALSE(core::Context::PublishHandle<std::string>().IsValid());
+
+  ctrl.LetStart();
+
+  test_protocol::TestMsg msg;
+  msg.set_str("abc");
+  handle.Publish(msg);
+  handle_cvt.Publish(std::string("abc"));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  GTEST_ASSERT_EQ(count, 1);
+  GTEST_ASSERT_EQ(count_cvt, 1);
+}
+
+TEST_F(ContextTest, PublishMoved)
+{
+  ctrl.LetInit();
+  core::Context& ctx = ctrl.GetContext();
+
+  const res::Channel<std::string> res_pub =
+    ctx.pub().Init<std::string, convert::By<test_protocol::TestMsg>>("/my_topic_moved");
+
+  const res::Channel<std::string> res_pub_reuse =
+    ctx.pub().Init<std::string, convert::By<test_protocol::TestMsg>>("/my_topic_moved_reuse", {.reuse_buffer = true});
+
+  const res::Channel<test_protocol::TestMsg> res_sub =
+    ctx.sub().Init<test_protocol::TestMsg>("/my_topic_moved");
+
+  const res::Channel<test_protocol::TestMsg> res_sub_reuse =
+    ctx.sub().Init<test_protocol::TestMsg>("/my_topic_moved_reuse");
+
+  std::atomic_int count = 0;
+  const auto callback   = [&](const test_protocol::TestMsg& msg) {
+    if (msg.str() == "abc")
+      ++count;
+  };
+
+  ctx.sub().SubscribeInline(res_sub, callback);
+  ctx.sub().SubscribeInline(res_sub_reuse, callback);
+
+  const core::Context::PublishHandle<std::string> handle = ctx.pub().Bind(res_pub_reuse);
+
+  ctrl.LetStart();
+
+  ctx.pub().Publish(res_pub, std::string("abc"));
+  ctx.pub().Publish(res_pub_reuse, std::string("abc"));
+  ctx.pub().Publish(res_pub_reuse, std::string("abc"));
+  handle.Publish(std::string("abc"));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  GTEST_ASSERT_EQ(count, 4);
+}
+
 TEST_F(ContextTest, Subscribe)
 {
   ctrl.LetInit();
@@ -260,6 +686,508 @@ TEST_F(ContextTest, Subscribe)
     });
 }
 
+TEST_F(ContextTest, SubscribePooled)
+{
+  ctrl.LetInit();
+  core::Context& ctx = ctrl.GetContext();
+
+  // 同一模块不能在一个话题上重复注册同一类型的订阅者，因此三种分发方式各自使用一个话题
+  const res::Channel<test_protocol::TestMsg> res_pub1 =
+    ctx.pub().Init<test_protocol::TestMsg>("/my_topic_pooled_1");
+
+  const res::Channel<test_protocol::TestMsg> res_pub2 =
+    ctx.pub().Init<test_protocol::TestMsg>("/my_topic_pooled_2");
+
+  const res::Channel<test_protocol::TestMsg> res_pub3 =
+    ctx.pub().Init<test_protocol::TestMsg>("/my_topic_pooled_3");
+
+  const res::Channel<test_protocol::TestMsg> res1 =
+    ctx.sub().Init<test_protocol::TestMsg>("/my_topic_pooled_1");
+
+  const res::Channel<test_protocol::TestMsg> res2 =
+    ctx.sub().Init<test_protocol::TestMsg>("/my_topic_pooled_2");
+
+  const res::Channel<std::string> res3 =
+    ctx.sub().Init<std::string, convert::By<test_protocol::TestMsg>>("/my_topic_pooled_3");
+
+  const res::Executor exe = ctx.InitExecutor("work_thread_pool");
+
+  // 分别计数，确保每种分发方式都收到了全部消息
+  std::array<std::atomic_int, 3> count{};
+
+  ctx.sub().SubscribeInline(
+    res1,
+    [&](const test_protocol::TestMsg& msg) {
+      if (msg.str() == "abc")
+        ++count[0];
+    },
+    {.pooled = true});
+
+  ctx.exe(exe).Subscribe(
+    res2,
+    [&](std::shared_ptr<const test_protocol::TestMsg> msg) -> co::Task<void> {
+      if (msg->str() == "abc")
+        ++count[1];
+      co_return;
+    },
+    {.pooled = true});
+
+  ctx.exe(exe).Subscribe(
+    res3,
+    [&](const std::string& msg) {
+      if (msg == "abc")
+        ++count[2];
+    },
+    {.pooled = true});
+
+  ctrl.LetStart();
+
+  test_protocol::TestMsg msg;
+  msg.set_str("abc");
+  for (int i = 0; i < 100; ++i) {
+    ctx.pub().Publish(res_pub1, msg);
+    ctx.pub().Publish(res_pub2, msg);
+    ctx.pub().Publish(res_pub3, msg);
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+  GTEST_ASSERT_EQ(count[0], 100);
+  GTEST_ASSERT_EQ(count[1], 100);
+  GTEST_ASSERT_EQ(count[2], 100);
+}
+
+TEST_F(ContextTest, SubscribeConflated)
+{
+  ctrl.LetInit();
+  core::Context& ctx = ctrl.GetContext();
+
+  const res::Channel<test_protocol::TestMsg> res_pub =
+    ctx.pub().Init<test_protocol::TestMsg>("/my_topic_conflated");
+
+  const res::Channel<test_protocol::TestMsg> res =
+    ctx.sub().Init<test_protocol::TestMsg>("/my_topic_conflated");
+
+  const res::Executor exe = ctx.InitExecutor("work_thread_pool");
+
+  std::atomic_int delivered = 0;
+  std::atomic_bool got_last = false;
+  ctx.exe(exe).Subscribe(
+    res,
+    [&](const test_protocol::TestMsg& msg) {
+      // 处理得比发布慢，迫使旧消息被合并
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      ++delivered;
+      if (msg.str() == "99")
+        got_last = true;
+    },
+    {.conflate = true});
+
+  ctrl.LetStart();
+
+  test_protocol::TestMsg msg;
+  for (int i = 0; i < 100; ++i) {
+    msg.set_str(std::to_string(i));
+    ctx.pub().Publish(res_pub, msg);
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+  // 最新的消息总会被处理，且每条消息要么被处理、要么被丢弃
+  const core::SubscribeStats stats = ctx.sub().GetStats(res);
+  GTEST_ASSERT_TRUE(got_last);
+  GTEST_ASSERT_EQ(stats.received, 100);
+  GTEST_ASSERT_EQ(stats.received, delivered + stats.dropped);
+}
+
+TEST_F(ContextTest, ConflateSlotDeliversLast)
+{
+  // 一个生产者、一个处理得较慢的消费者，每一轮发布结束后，最后放入的消息总应被处理
+  core::details::ConflateSlot<int> slot;
+  std::counting_semaphore<> schedules(0);
+
+  std::atomic_int last    = -1;
+  std::atomic_int running = 0;
+  std::atomic_bool stop   = false;
+
+  std::thread consumer([&]() {
+    while (true) {
+      schedules.acquire();
+      if (stop.load())
+        return;
+
+      do {
+        while (const std::shared_ptr<const int> msg = slot.Take()) {
+          last.store(*msg);
+          std::this_thread::yield();
+        }
+      } while (slot.Reschedule());
+
+      running.fetch_sub(1);
+    }
+  });
+
+  for (int round = 0; round < 200; ++round) {
+    for (int i = 0; i < 1000; ++i) {
+      slot.Put(std::make_shared<const int>(round * 1000 + i));
+
+      if (slot.TrySchedule()) {
+        running.fetch_add(1);
+        schedules.release();
+      }
+    }
+
+    while (running.load() != 0)
+      std::this_thread::yield();
+
+    GTEST_ASSERT_EQ(last.load(), round * 1000 + 999);
+    GTEST_ASSERT_EQ(slot.Take(), nullptr);
+  }
+
+  stop = true;
+  schedules.release();
+  consumer.join();
+}
+
+TEST_F(ContextTest, SubscribeBoundedQueue)
+{
+  ctrl.LetInit();
+  core::Context& ctx = ctrl.GetContext();
+
+  const res::Channel<test_protocol::TestMsg> res_pub =
+    ctx.pub().Init<test_protocol::TestMsg>("/my_topic_bounded");
+
+  // 队列配置在初始化信道时给定，注册回调时沿用
+  const res::Channel<test_protocol::TestMsg> res =
+    ctx.sub().Init<test_protocol::TestMsg>("/my_topic_bounded", {.depth = 4, .policy = core::QueuePolicy::DropNewest});
+
+  const res::Executor exe = ctx.InitExecutor("work_thread_pool");
+
+  std::atomic_int delivered = 0;
+  std::atomic_bool in_order = true;
+  std::atomic_int last      = -1;
+  ctx.exe(exe).Subscribe(
+    res,
+    [&](const test_protocol::TestMsg& msg) {
+      // 处理得比发布慢，迫使队列被填满
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      const int idx = std::stoi(msg.str());
+      if (idx <= last.exchange(idx))
+        in_order = false;
+      ++delivered;
+    });
+
+  ctrl.LetStart();
+
+  test_protocol::TestMsg msg;
+  for (int i = 0; i < 100; ++i) {
+    msg.set_str(std::to_string(i));
+    ctx.pub().Publish(res_pub, msg);
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+  // 消息按序处理，队列已排空，且每条消息要么被处理、要么被丢弃
+  const core::SubscribeStats stats = ctx.sub().GetStats(res);
+  GTEST_ASSERT_TRUE(in_order);
+  GTEST_ASSERT_EQ(stats.capacity, 4);
+  GTEST_ASSERT_EQ(stats.queued, 0);
+  GTEST_ASSERT_EQ(stats.received, 100);
+  GTEST_ASSERT_EQ(stats.received, delivered + stats.dropped);
+
+  // 统计数据同样可以在进程级的监控中取得
+  bool found = false;
+  for (const core::TopicSubscribeStats& one : core::CollectSubscribeStats())
+    found = found or (one.topic_name == "/my_topic_bounded" and one.stats.received == 100);
+
+  GTEST_ASSERT_TRUE(found);
+}
+
+TEST_F(ContextTest, SubscribeBoundedQueueBlock)
+{
+  ctrl.LetInit();
+  core::Context& ctx = ctrl.GetContext();
+
+  const res::Channel<test_protocol::TestMsg> res_pub =
+    ctx.pub().Init<test_protocol::TestMsg>("/my_topic_bounded_block");
+
+  const res::Channel<test_protocol::TestMsg> res =
+    ctx.sub().Init<test_protocol::TestMsg>("/my_topic_bounded_block");
+
+  const res::Executor exe = ctx.InitExecutor("work_thread_pool");
+
+  std::atomic_int delivered = 0;
+  ctx.exe(exe).Subscribe(
+    res,
+    [&](const test_protocol::TestMsg&) {
+      std::this_thread::sleep_for(std::chrono::microseconds(200));
+      ++delivered;
+    },
+    {.queue = {.depth = 2, .policy = core::QueuePolicy::Block, .block_timeout = std::chrono::milliseconds(20)}});
+
+  ctrl.LetStart();
+
+  test_protocol::TestMsg msg;
+  for (int i = 0; i < 50; ++i)
+    ctx.pub().Publish(res_pub, msg);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+
+  // 阻塞策略下，队列满时回调被阻塞，仅等待超时的消息被丢弃
+  const core::SubscribeStats stats = ctx.sub().GetStats(res);
+  GTEST_ASSERT_EQ(stats.received, 50);
+  GTEST_ASSERT_EQ(stats.queued, 0);
+  GTEST_ASSERT_EQ(stats.received, delivered + stats.dropped);
+}
+
+TEST_F(ContextTest, SubscribeBoundedQueueBlockShutdown)
+{
+  ctrl.LetInit();
+  core::Context& ctx = ctrl.GetContext();
+
+  const res::Channel<test_protocol::TestMsg> res_pub =
+    ctx.pub().Init<test_protocol::TestMsg>("/my_topic_bounded_block_shutdown");
+
+  const res::Channel<test_protocol::TestMsg> res =
+    ctx.sub().Init<test_protocol::TestMsg>("/my_topic_bounded_block_shutdown");
+
+  const res::Executor exe = ctx.InitExecutor("work_thread_pool");
+
+  // 处理第一条消息时一直占住处理任务，使队列保持已满
+  std::promise<void> release;
+  std::shared_future<void> release_future = release.get_future().share();
+
+  ctx.exe(exe).Subscribe(
+    res,
+    [release_future](const test_protocol::TestMsg&) { release_future.wait(); },
+    {.queue = {.depth = 1, .policy = core::QueuePolicy::Block, .block_timeout = std::chrono::seconds(10)}});
+
+  ctrl.LetStart();
+
+  std::thread publisher([&]() {
+    test_protocol::TestMsg msg;
+    for (int i = 0; i < 3; ++i)
+      ctx.pub().Publish(res_pub, msg);
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  GTEST_ASSERT_EQ(ctx.sub().GetStats(res).dropped, 0);
+
+  // 模块被要求退出时，阻塞的通信线程立即放弃等待，而不是等满超时
+  ctx.RequireToShutdown();
+
+  for (int i = 0; i < 100 and ctx.sub().GetStats(res).dropped == 0; ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  GTEST_ASSERT_EQ(ctx.sub().GetStats(res).dropped, 1);
+
+  release.set_value();
+  publisher.join();
+}
+
+TEST_F(ContextTest, IntraProcess)
+{
+  // 进程内通信需要在信道初始化之前启用
+  core::EnableIntraProcessTopic("/my_topic_intra");
+  GTEST_ASSERT_TRUE(core::IsIntraProcessTopic("/my_topic_intra"));
+
+  ctrl.LetInit();
+  core::Context& ctx = ctrl.GetContext();
+
+  const res::Channel<test_protocol::TestMsg> res_pub =
+    ctx.pub().Init<test_protocol::TestMsg>("/my_topic_intra");
+
+  const res::Channel<test_protocol::TestMsg> res =
+    ctx.sub().Init<test_protocol::TestMsg>("/my_topic_intra");
+
+  const res::Executor exe = ctx.InitExecutor("work_thread_pool");
+
+  // 订阅者收到的是发布者给出的同一个对象
+  const test_protocol::TestMsg* inline_ptr = nullptr;
+  std::atomic<const test_protocol::TestMsg*> exe_ptr = nullptr;
+
+  ctx.sub().SubscribeInline(
+    res,
+    [&](std::shared_ptr<const test_protocol::TestMsg> msg) {
+      inline_ptr = msg.get();
+    });
+
+  ctx.exe(exe).Subscribe(
+    res,
+    [&](std::shared_ptr<const test_protocol::TestMsg> msg) {
+      exe_ptr = msg.get();
+    });
+
+  ctrl.LetStart();
+
+  auto msg = std::make_shared<test_protocol::TestMsg>();
+  msg->set_str("abc");
+  ctx.pub().PublishShared<test_protocol::TestMsg>(res_pub, msg);
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  GTEST_ASSERT_EQ(inline_ptr, msg.get());
+  GTEST_ASSERT_EQ(exe_ptr, msg.get());
+
+  // 常引用与右值的发布同样经过进程内信道
+  ctx.pub().Publish(res_pub, *msg);
+  ctx.pub().Publish(res_pub, test_protocol::TestMsg(*msg));
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  GTEST_ASSERT_EQ(ctx.sub().GetStats(res).received, 6);
+}
+
+/**
+ * @brief 另一个模块，用于与被测模块在同一话题上各自注册同一类型的订阅者
+ */
+class PeerModule : public aimrt::ModuleBase
+{
+ public:
+  explicit PeerModule(std::function<void(core::Context&)> on_init)
+      : on_init_(std::move(on_init))
+  {
+  }
+
+  aimrt::ModuleInfo Info() const noexcept override
+  {
+    return {.name = "PeerModule"};
+  }
+
+  bool Initialize(aimrt::CoreRef core) noexcept override
+  {
+    ctx_ptr_ = std::make_shared<core::Context>(core);
+    on_init_(*ctx_ptr_);
+    return true;
+  }
+
+  bool Start() noexcept override
+  {
+    return true;
+  }
+
+  void Shutdown() noexcept override
+  {
+    ctx_ptr_->RequireToShutdown();
+    ctx_ptr_.reset();
+  }
+
+ private:
+  std::function<void(core::Context&)> on_init_;
+  std::shared_ptr<core::Context> ctx_ptr_;
+};
+
+TEST_F(ContextTest, SubscribeSharedConverted)
+{
+  constexpr int kMessages = 100;
+
+  // 两个模块的订阅者收到的转换结果，按消息的序号存放，并持有它们，使缓存项在比较之前一直有效
+  std::mutex mutex;
+  std::array<std::vector<std::shared_ptr<const std::string>>, 2> received;
+  received[0].resize(kMessages);
+  received[1].resize(kMessages);
+
+  // 回收检查中，各条消息的转换结果的地址与容量
+  std::vector<std::pair<const std::string*, std::size_t>> recycled;
+
+  const auto make_callback = [&](const std::size_t who) {
+    return [&, who](std::shared_ptr<const std::string> msg) {
+      const std::lock_guard lock(mutex);
+      received[who][std::stoi(*msg)] = std::move(msg);
+    };
+  };
+
+  // 同一模块不能在一个话题上重复注册同一类型的订阅者，因此由另一个模块订阅同一话题
+  PeerModule peer([&](core::Context& ctx) {
+    const res::Channel<std::string> res =
+      ctx.sub().Init<std::string, convert::By<test_protocol::TestMsg>>("/my_topic_shared_converted");
+
+    ctx.sub().SubscribeInline(res, make_callback(1), {.share_converted = true});
+  });
+
+  ctrl.RegisterModule("PeerModule", peer);
+  AIMRTE(defer(ctrl.LetEnd()));
+
+  ctrl.LetInit();
+  core::Context& ctx = ctrl.GetContext();
+
+  const res::Channel<test_protocol::TestMsg> res_pub =
+    ctx.pub().Init<test_protocol::TestMsg>("/my_topic_shared_converted");
+
+  const res::Channel<std::string> res_sub =
+    ctx.sub().Init<std::string, convert::By<test_protocol::TestMsg>>("/my_topic_shared_converted");
+
+  const res::Executor exe = ctx.InitExecutor("work_thread_pool");
+  ctx.exe(exe).Subscribe(res_sub, make_callback(0), {.pooled = true, .share_converted = true});
+
+  // 在另一个话题上检查转换结果的回收：回收的对象保留了上一条消息的内容与容量
+  const res::Channel<test_protocol::TestMsg> res_pub_recycle =
+    ctx.pub().Init<test_protocol::TestMsg>("/my_topic_recycle_converted");
+
+  const res::Channel<std::string> res_sub_recycle =
+    ctx.sub().Init<std::string, convert::By<test_protocol::TestMsg>>("/my_topic_recycle_converted");
+
+  ctx.sub().SubscribeInline(
+    res_sub_recycle,
+    [&](const std::string& msg) {
+      const std::lock_guard lock(mutex);
+      recycled.emplace_back(&msg, msg.capacity());
+    },
+    {.recycle_converted = 1});
+
+  ctrl.LetStart();
+
+  test_protocol::TestMsg msg;
+  for (int i = 0; i < kMessages; ++i) {
+    msg.set_str(std::to_string(i));
+    ctx.pub().Publish(res_pub, msg);
+  }
+
+  // 逐条发布，使上一条消息的转换结果在下一条到来之前被回收
+  msg.set_str(std::string(1000, 'x'));
+  ctx.pub().Publish(res_pub_recycle, msg);
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+  msg.set_str("abc");
+  ctx.pub().Publish(res_pub_recycle, msg);
+  std::this_thread::sleep_for(std::chrono::milliseconds(200));
+
+  const std::lock_guard lock(mutex);
+
+  // 同一条消息在两个模块中共享同一个转换结果，也即只转换了一次
+  for (int i = 0; i < kMessages; ++i) {
+    GTEST_ASSERT_NE(received[0][i], nullptr);
+    GTEST_ASSERT_EQ(received[0][i].get(), received[1][i].get());
+  }
+
+  GTEST_ASSERT_EQ(recycled.size(), 2);
+  GTEST_ASSERT_EQ(recycled[0].first, recycled[1].first);
+  GTEST_ASSERT_GE(recycled[1].second, 1000);
+}
+
+TEST_F(ContextTest, TimerWheelShared)
+{
+  core::EnableTimerWheel("work_thread_pool", std::chrono::milliseconds(1));
+  AIMRTE(defer(core::EnableTimerWheel("work_thread_pool", {})));
+
+  // 使用同一执行器的两个模块，共享同一个时间轮
+  core::details::TimerWheel* peer_wheel = nullptr;
+
+  PeerModule peer([&](core::Context& ctx) {
+    const res::Executor exe = ctx.InitExecutor("work_thread_pool");
+    peer_wheel              = core::Context::OpExe::GetTimerWheel(ctx.exe(exe));
+  });
+
+  ctrl.RegisterModule("PeerModule", peer);
+  AIMRTE(defer(ctrl.LetEnd()));
+
+  ctrl.LetInit();
+  core::Context& ctx = ctrl.GetContext();
+
+  const res::Executor exe = ctx.InitExecutor("work_thread_pool");
+
+  core::details::TimerWheel* wheel = core::Context::OpExe::GetTimerWheel(ctx.exe(exe));
+  GTEST_ASSERT_NE(wheel, nullptr);
+  GTEST_ASSERT_EQ(wheel, peer_wheel);
+}
+
 TEST_F(ContextTest, Client)
 {
   ctrl.LetInit();
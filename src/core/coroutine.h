@@ -7,6 +7,7 @@
 #include "src/interface/aimrt_module_cpp_interface/co/on.h"
 #include "src/interface/aimrt_module_cpp_interface/co/task.h"
 
+#include "./details/block_pool.h"
 #include "./details/thread_context.h"
 #include "src/macro/macro.h"
 #include "src/interface/aimrt_module_cpp_interface/co/async_scope.h"
@@ -47,6 +48,9 @@ namespace aimrte::co
 {
 inline thread_local bool synchronized{false};
 
+// 当前线程上同步等待的协程，自本次同步等待开始以来，已经在原地让出执行的次数，用于退避
+inline thread_local std::uint32_t synchronized_yields{0};
+
 /**
  * @brief 对 AimRT 协程的封装，在协程执行之前，初始化上下文信息
  */
@@ -57,6 +61,20 @@ class Task : public aimrt::co::Task<T>
   class Promise : public details::ReturnValueOrVoid<Promise, T>
   {
    public:
+    /**
+     * @brief 协程帧从按尺寸分级的内存池中申请，避免每次创建协程都经由全局堆。
+     *        协程帧的尺寸在编译期确定，同一协程函数的帧总落在同一尺寸等级中。
+     */
+    static void* operator new(const std::size_t size)
+    {
+      return core::details::BlockPool::Allocate(size);
+    }
+
+    static void operator delete(void* ptr, const std::size_t size) noexcept
+    {
+      core::details::BlockPool::Deallocate(ptr, size);
+    }
+
     auto get_return_object() noexcept
     {
       return Task{promise_.get_return_object()};
@@ -65,23 +83,23 @@ class Task : public aimrt::co::Task<T>
     decltype(auto) initial_suspend() noexcept
     {
       struct Awaiter final {
-        core::details::ThreadContext ctx;
+        const core::details::ThreadContext* ctx;
 
         constexpr bool await_ready() const noexcept { return false; }
 
         constexpr void await_suspend(std::coroutine_handle<>) const noexcept {}
 
-        void await_resume() noexcept
+        void await_resume() const noexcept
         {
           // 协程唤醒时，准备好执行上下文，协程中的过程将用到它
-          core::details::g_thread_ctx = std::move(ctx);
+          core::details::SwitchThreadContext(*ctx);
         }
       };
 
-      // 协程初始化时，记录 core::Context 为其准备的上下文
+      // 协程初始化时，记录 core::Context 为其准备的上下文，此后只传递指针
       ctx_ = core::details::g_thread_ctx;
 
-      return Awaiter{ctx_};
+      return Awaiter{&ctx_};
     }
 
     auto final_suspend() const noexcept
@@ -107,7 +125,7 @@ class Task : public aimrt::co::Task<T>
         decltype(promise_.await_transform(std::forward<Value>(value)))
           awaiter;
 
-        core::details::ThreadContext ctx;
+        const core::details::ThreadContext* ctx;
 
         bool await_ready() noexcept
         {
@@ -117,7 +135,7 @@ class Task : public aimrt::co::Task<T>
         auto await_resume() noexcept
         {
           // 协程唤醒时，准备好执行上下文，协程中的过程将用到它
-          core::details::g_thread_ctx = std::move(ctx);
+          core::details::SwitchThreadContext(*ctx);
           return awaiter.await_resume();
         }
 
@@ -129,7 +147,7 @@ class Task : public aimrt::co::Task<T>
         }
       };
 
-      return Awaiter{promise_.await_transform(std::forward<Value>(value)), ctx_};
+      return Awaiter{promise_.await_transform(std::forward<Value>(value)), &ctx_};
     }
 
     auto unhandled_done() noexcept
@@ -186,9 +204,10 @@ Perhaps use 'co_await your_co_func()' or 'your_co_func().Sync()' ?)");
   {
     used_ = true;
 
-    // 告知相关协程过程，当前协程被同步在线程上
-    synchronized = true;
-    AIMRTE(defer(synchronized = false));
+    // 告知相关协程过程，当前协程被同步在线程上。同步等待可能嵌套，退出时恢复外层的状态
+    const bool outer_synchronized    = std::exchange(synchronized, true);
+    const std::uint32_t outer_yields = std::exchange(synchronized_yields, 0);
+    AIMRTE(defer(synchronized = outer_synchronized, synchronized_yields = outer_yields));
 
     if constexpr (std::is_void_v<T>)
       aimrt::co::SyncWait(std::move(*this));
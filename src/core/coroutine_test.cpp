@@ -3,7 +3,10 @@
 
 #include "./coroutine.h"
 #include "src/interface/aimrt_module_cpp_interface/co/sync_wait.h"
+#include "src/test/test.h"
+#include <future>
 #include <gtest/gtest.h>
+#include <thread>
 
 namespace aimrte::test
 {
@@ -56,4 +59,99 @@ TEST_F(CoTaskTest, ReturnValue)
   GTEST_ASSERT_EQ(MyValueFuncCaller(3).Sync(), 6);
   GTEST_ASSERT_EQ(aimrt::co::SyncWait(MyValueFuncCaller(4)), 8);
 }
+
+co::Task<bool> NestedSyncFunc()
+{
+  // 嵌套的同步等待结束后，外层仍然处于同步等待中
+  MyVoidFunc().Sync();
+  co_return co::synchronized;
+}
+
+TEST_F(CoTaskTest, NestedSync)
+{
+  GTEST_ASSERT_FALSE(co::synchronized);
+  GTEST_ASSERT_TRUE(NestedSyncFunc().Sync());
+  GTEST_ASSERT_FALSE(co::synchronized);
+}
+
+class CoYieldTest : public ::testing::Test
+{
+ protected:
+  void SetUp() override
+  {
+    ctrl.SetDefaultConfigContent();
+    ctrl.LetInit();
+
+    // 单线程的执行器，以便检查让出后所在的线程
+    thread_safe_exe = ctx::init::Executor(ctrl.GetDefaultConfig().thread_safe_exe);
+
+    ctrl.LetStart();
+  }
+
+ public:
+  ModuleTestController ctrl;
+  ctx::Executor thread_safe_exe;
+};
+
+co::Task<std::thread::id> YieldAndGetThreadId()
+{
+  co_await ctx::Yield();
+  co_return std::this_thread::get_id();
+}
+
+TEST_F(CoYieldTest, SyncYieldFromForeignThread)
+{
+  // 在执行器的线程上取得其线程 id 与上下文
+  std::promise<std::pair<std::thread::id, core::details::ThreadContext>> exe_info;
+
+  thread_safe_exe.Post([&]() {
+    exe_info.set_value({std::this_thread::get_id(), core::details::g_thread_ctx});
+  });
+
+  const auto [exe_thread_id, exe_thread_ctx] = exe_info.get_future().get();
+
+  // 在外部线程上使用该上下文同步等待，它并非执行器的线程，让出后应当回到执行器上继续执行
+  std::thread::id resumed_thread_id;
+
+  std::thread([&resumed_thread_id, thread_ctx{exe_thread_ctx}]() {
+    core::details::SwitchThreadContext(thread_ctx);
+    resumed_thread_id = YieldAndGetThreadId().Sync();
+  }).join();
+
+  GTEST_ASSERT_EQ(resumed_thread_id, exe_thread_id);
+}
+
+co::Task<bool> SpinYield(const std::uint32_t times)
+{
+  const std::thread::id thread_id = std::this_thread::get_id();
+
+  for (std::uint32_t i = 0; i < times; ++i) {
+    co_await ctx::Yield();
+
+    // 同步等待的正是执行器的线程，只能在原地让出
+    if (std::this_thread::get_id() != thread_id)
+      co_return false;
+  }
+
+  co_return co::synchronized_yields == times;
+}
+
+TEST_F(CoYieldTest, SyncYieldOnExecutorThreadBacksOff)
+{
+  constexpr std::uint32_t kTimes = 40;
+  std::promise<std::pair<bool, std::chrono::steady_clock::duration>> result;
+
+  thread_safe_exe.Post([&]() {
+    const auto start = std::chrono::steady_clock::now();
+    const bool ok    = SpinYield(kTimes).Sync();
+    result.set_value({ok, std::chrono::steady_clock::now() - start});
+  });
+
+  const auto [ok, elapsed] = result.get_future().get();
+  GTEST_ASSERT_TRUE(ok);
+
+  // 前 16 次仅让出时间片，之后依次休眠 1us, 2us, ..., 1024us ，再以 1024us 封顶，
+  // 总计不少于 (2^11 - 1) + 13 * 1024 us ，说明它退避到了休眠，而非一直空转
+  GTEST_ASSERT_GE(elapsed, std::chrono::microseconds(2047 + 13 * 1024));
+}
 }  // namespace aimrte::test
@@ -0,0 +1,128 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./block_pool.h"
+#include <array>
+#include <mutex>
+
+namespace aimrte::core::details
+{
+namespace
+{
+struct FreeBlock {
+  FreeBlock* next;
+};
+
+struct FreeList {
+  FreeBlock* head    = nullptr;
+  std::size_t count = 0;
+
+  void Push(void* ptr) noexcept
+  {
+    auto* block = static_cast<FreeBlock*>(ptr);
+    block->next = head;
+    head        = block;
+    ++count;
+  }
+
+  void* Pop() noexcept
+  {
+    FreeBlock* block = head;
+    head             = block->next;
+    --count;
+    return block;
+  }
+};
+
+/**
+ * @brief 全局的各尺寸等级空闲链表，仅在线程缓存溢出或耗尽时，以批量的方式访问
+ */
+struct GlobalPool {
+  std::mutex mutex;
+  std::array<FreeList, BlockPool::kClassCount> lists;
+};
+
+GlobalPool& GetGlobalPool()
+{
+  // 全局池永不析构，以免其他静态对象析构时释放块，遇到已析构的全局池
+  static auto* pool = new GlobalPool;
+  return *pool;
+}
+
+/**
+ * @brief 线程本地的各尺寸等级空闲链表，线程退出时将所有块归还到全局池
+ */
+struct ThreadCache {
+  std::array<FreeList, BlockPool::kClassCount> lists;
+
+  ~ThreadCache()
+  {
+    GlobalPool& global = GetGlobalPool();
+    const std::lock_guard lock(global.mutex);
+
+    for (std::size_t i = 0; i < lists.size(); ++i) {
+      while (lists[i].head != nullptr)
+        global.lists[i].Push(lists[i].Pop());
+    }
+  }
+};
+
+thread_local ThreadCache g_thread_cache;
+
+// 线程缓存与全局池之间，单次批量转移的块数量
+constexpr std::size_t kBatchSize = BlockPool::kThreadCacheLimit / 2;
+}  // namespace
+
+void* BlockPool::Allocate(const std::size_t size)
+{
+  if (size == 0 or size > kMaxBlockSize) [[unlikely]]
+    return ::operator new(size);
+
+  const std::size_t idx = ClassOf(size);
+  FreeList& local       = g_thread_cache.lists[idx];
+
+  if (local.head != nullptr) [[likely]]
+    return local.Pop();
+
+  // 本线程缓存耗尽，从全局池批量取回
+  {
+    GlobalPool& global = GetGlobalPool();
+    const std::lock_guard lock(global.mutex);
+
+    FreeList& shared = global.lists[idx];
+    for (std::size_t i = 0; i < kBatchSize and shared.head != nullptr; ++i)
+      local.Push(shared.Pop());
+  }
+
+  if (local.head != nullptr)
+    return local.Pop();
+
+  return ::operator new((idx + 1) * kGranularity);
+}
+
+void BlockPool::Deallocate(void* ptr, const std::size_t size) noexcept
+{
+  if (ptr == nullptr)
+    return;
+
+  if (size == 0 or size > kMaxBlockSize) [[unlikely]] {
+    ::operator delete(ptr);
+    return;
+  }
+
+  const std::size_t idx = ClassOf(size);
+  FreeList& local       = g_thread_cache.lists[idx];
+  local.Push(ptr);
+
+  if (local.count <= kThreadCacheLimit) [[likely]]
+    return;
+
+  // 本线程缓存溢出，批量归还一半到全局池
+  GlobalPool& global = GetGlobalPool();
+  const std::lock_guard lock(global.mutex);
+
+  FreeList& shared = global.lists[idx];
+  for (std::size_t i = 0; i < kBatchSize; ++i)
+    shared.Push(local.Pop());
+}
+}  // namespace aimrte::core::details
@@ -0,0 +1,86 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <new>
+
+namespace aimrte::core::details
+{
+/**
+ * @brief 按尺寸分级的内存块池，用于高频、短生命周期的小对象（消息句柄的控制块、协程帧等）。
+ *
+ * 每个线程为每一尺寸等级维护一个有上限的空闲链表，释放的块优先回到本线程链表，
+ * 超出上限时，一半的块被批量归还到全局链表；本线程链表为空时，先从全局链表批量取回，
+ * 最后才向系统申请。超过最大等级的尺寸直接使用 ::operator new 。
+ *
+ * @note 块可以在任意线程释放，与申请它的线程无关。
+ */
+class BlockPool
+{
+ public:
+  // 尺寸等级的粒度
+  static constexpr std::size_t kGranularity = 64;
+
+  // 被池化的最大块尺寸
+  static constexpr std::size_t kMaxBlockSize = 4096;
+
+  // 尺寸等级数量
+  static constexpr std::size_t kClassCount = kMaxBlockSize / kGranularity;
+
+  // 每个线程、每个尺寸等级，最多缓存的块数量
+  static constexpr std::size_t kThreadCacheLimit = 64;
+
+  /**
+   * @brief 申请指定尺寸的内存块，对齐为 __STDCPP_DEFAULT_NEW_ALIGNMENT__
+   */
+  static void* Allocate(std::size_t size);
+
+  /**
+   * @brief 释放内存块，size 必须与申请时一致
+   */
+  static void Deallocate(void* ptr, std::size_t size) noexcept;
+
+ private:
+  static constexpr std::size_t ClassOf(const std::size_t size)
+  {
+    return (size + kGranularity - 1) / kGranularity - 1;
+  }
+};
+
+/**
+ * @brief 基于 BlockPool 的标准分配器，可用于 std::allocate_shared 或 std::shared_ptr 的控制块分配。
+ */
+template <class T>
+class PoolAllocator
+{
+  static_assert(alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__, "over-aligned type is not supported");
+
+ public:
+  using value_type = T;
+
+  PoolAllocator() noexcept = default;
+
+  template <class U>
+  PoolAllocator(const PoolAllocator<U>&) noexcept
+  {
+  }
+
+  T* allocate(const std::size_t n)
+  {
+    return static_cast<T*>(BlockPool::Allocate(n * sizeof(T)));
+  }
+
+  void deallocate(T* ptr, const std::size_t n) noexcept
+  {
+    BlockPool::Deallocate(ptr, n * sizeof(T));
+  }
+
+  template <class U>
+  bool operator==(const PoolAllocator<U>&) const noexcept
+  {
+    return true;
+  }
+};
+}  // namespace aimrte::core::details
@@ -0,0 +1,156 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include "../cancel_token.h"
+#include "../subscribe_option.h"
+#include "../subscribe_stats.h"
+
+namespace aimrte::core::details
+{
+/**
+ * @brief 有界的待处理消息队列，用于有界队列模式的订阅。
+ *
+ * 生产者（原生通信回调）通过 Put 放入消息，队列已满时按策略丢弃或阻塞，
+ * 并从返回值得知是否需要启动处理任务；处理任务通过 Take 逐一取出消息，
+ * 在队列为空时交还处理权。任一时刻至多存在一个处理任务，消息按到来的顺序处理。
+ * 队列的长度、丢弃与阻塞次数，将同步到订阅的统计计数器中。
+ *
+ * 阻塞策略下，生产者在条件变量上等待，由处理任务取出消息时、或模块被要求退出时（退出令牌的回调）唤醒，
+ * 不会周期性地轮询；至多等待 QueueOption::block_timeout 。
+ */
+template <class T>
+class BoundedQueue : public std::enable_shared_from_this<BoundedQueue<T>>
+{
+ public:
+  /**
+   * @param shutdown 消息处理者所在模块的退出令牌，被取消后，阻塞的生产者立即放弃等待
+   */
+  BoundedQueue(const QueueOption& option, std::shared_ptr<SubscribeCounter> counter, CancelToken shutdown)
+      : option_(option), counter_(std::move(counter)), shutdown_(std::move(shutdown))
+  {
+    counter_->capacity.store(option_.depth, std::memory_order_relaxed);
+  }
+
+  BoundedQueue(const BoundedQueue&)            = delete;
+  BoundedQueue& operator=(const BoundedQueue&) = delete;
+
+  /**
+   * @brief 放入新的消息，队列已满时按策略处理。阻塞策略下，若模块被要求退出、或等待超时，将放弃等待并丢弃该消息。
+   * @return 调用者是否需要启动处理任务
+   */
+  bool Put(std::shared_ptr<const T> msg)
+  {
+    std::unique_lock lock(mutex_);
+
+    if (queue_.size() >= option_.depth) {
+      switch (option_.policy) {
+        case QueuePolicy::DropOldest:
+          queue_.pop_front();
+          counter_->dropped.fetch_add(1, std::memory_order_relaxed);
+          break;
+
+        case QueuePolicy::DropNewest:
+          counter_->dropped.fetch_add(1, std::memory_order_relaxed);
+          return false;
+
+        case QueuePolicy::Block:
+          counter_->blocked.fetch_add(1, std::memory_order_relaxed);
+
+          if (not WaitNotFull(lock)) {
+            counter_->dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+          }
+          break;
+      }
+    }
+
+    queue_.push_back(std::move(msg));
+    counter_->queued.store(queue_.size(), std::memory_order_relaxed);
+
+    if (scheduled_)
+      return false;
+
+    scheduled_ = true;
+    return true;
+  }
+
+  /**
+   * @return 取出最早的消息。队列为空时返回空指针，并交还处理权，处理任务应当结束。
+   */
+  std::shared_ptr<const T> Take()
+  {
+    std::shared_ptr<const T> msg;
+
+    {
+      const std::lock_guard lock(mutex_);
+
+      if (queue_.empty()) {
+        scheduled_ = false;
+        return nullptr;
+      }
+
+      msg = std::move(queue_.front());
+      queue_.pop_front();
+      counter_->queued.store(queue_.size(), std::memory_order_relaxed);
+    }
+
+    if (option_.policy == QueuePolicy::Block)
+      not_full_.notify_one();
+
+    return msg;
+  }
+
+ private:
+  /**
+   * @brief 等待队列出现空位，由 Take 或退出令牌的回调唤醒。须持有锁
+   * @return 是否出现了空位；模块被要求退出、或等待超时时返回 false
+   */
+  bool WaitNotFull(std::unique_lock<std::mutex>& lock)
+  {
+    // 以各个等待者自己的锁对象的地址作为登记的键。回调可能在注销之后仍在执行，因此只持有本队列的弱引用；
+    // 持锁通知，避免在等待者检查条件与进入等待之间错过
+    const void* key = &lock;
+
+    const bool registered = shutdown_.Register(
+      key,
+      [weak_self = this->weak_from_this()]() {
+        if (const std::shared_ptr<BoundedQueue> self = weak_self.lock(); self != nullptr) {
+          const std::lock_guard notify_lock(self->mutex_);
+          self->not_full_.notify_all();
+        }
+      });
+
+    if (not registered)
+      return false;
+
+    const bool not_full = not_full_.wait_for(
+      lock, option_.block_timeout, [this]() { return queue_.size() < option_.depth or shutdown_.IsCancelled(); });
+
+    shutdown_.Unregister(key);
+    return not_full and queue_.size() < option_.depth;
+  }
+
+ private:
+  const QueueOption option_;
+  const std::shared_ptr<SubscribeCounter> counter_;
+
+  // 消息处理者所在模块的退出令牌
+  const CancelToken shutdown_;
+
+  std::mutex mutex_;
+  std::condition_variable not_full_;
+
+  // 待处理的消息
+  std::deque<std::shared_ptr<const T>> queue_;
+
+  // 是否已存在处理任务
+  bool scheduled_ = false;
+};
+}  // namespace aimrte::core::details
@@ -0,0 +1,132 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <memory>
+#include "./block_pool.h"
+
+namespace aimrte::core::details
+{
+/**
+ * @brief 仅保留最新一条消息的无锁槽位，用于合并（conflate）模式的订阅。
+ *
+ * 生产者（原生通信回调）通过 Put 替换槽位中的消息，并通过 TrySchedule 竞争唯一的处理任务；
+ * 处理任务通过 Take 取出消息，在槽位为空时，通过 Reschedule 判断是否需要继续处理。
+ * 任一时刻至多存在一个处理任务。
+ *
+ * “放入消息、再竞争处理权” 与 “释放处理权、再检查消息” 两组操作均为 seq_cst ，构成 Dekker 式的配对，
+ * 确保两方中至少有一方看到对方的修改，最新的消息不会滞留在槽位中。
+ * 承载消息的盒子在槽位内循环使用，稳定状态下放入消息不再申请内存。
+ */
+template <class T>
+class ConflateSlot
+{
+  struct Box {
+    std::shared_ptr<const T> msg;
+
+    static void* operator new(const std::size_t size)
+    {
+      return BlockPool::Allocate(size);
+    }
+
+    static void operator delete(void* ptr, const std::size_t size) noexcept
+    {
+      BlockPool::Deallocate(ptr, size);
+    }
+  };
+
+ public:
+  ConflateSlot() = default;
+
+  ~ConflateSlot()
+  {
+    delete latest_.exchange(nullptr, std::memory_order_acquire);
+    delete spare_.exchange(nullptr, std::memory_order_acquire);
+  }
+
+  ConflateSlot(const ConflateSlot&)            = delete;
+  ConflateSlot& operator=(const ConflateSlot&) = delete;
+
+  /**
+   * @brief 放入最新的消息
+   * @return 是否替换掉了一条尚未被处理的消息
+   */
+  bool Put(std::shared_ptr<const T> msg)
+  {
+    Box* box = spare_.exchange(nullptr, std::memory_order_acquire);
+    if (box == nullptr)
+      box = new Box;
+
+    box->msg = std::move(msg);
+
+    Box* old = latest_.exchange(box, std::memory_order_seq_cst);
+    if (old == nullptr)
+      return false;
+
+    Recycle(old);
+    return true;
+  }
+
+  /**
+   * @return 取出最新的消息，槽位为空时返回空指针
+   */
+  std::shared_ptr<const T> Take()
+  {
+    Box* box = latest_.exchange(nullptr, std::memory_order_acq_rel);
+    if (box == nullptr)
+      return nullptr;
+
+    std::shared_ptr<const T> msg = std::move(box->msg);
+    Recycle(box);
+    return msg;
+  }
+
+  /**
+   * @return 调用者是否需要启动处理任务
+   */
+  bool TrySchedule()
+  {
+    return not scheduled_.exchange(true, std::memory_order_seq_cst);
+  }
+
+  /**
+   * @brief 处理任务在槽位为空时调用，释放处理权。
+   *        若释放期间又有新的消息放入，且重新取得了处理权，则返回 true ，处理任务应当继续。
+   */
+  bool Reschedule()
+  {
+    // 不能使用 store ：store 与其后的 load 可能被重排，使双方都错过对方的修改
+    scheduled_.exchange(false, std::memory_order_seq_cst);
+
+    if (latest_.load(std::memory_order_seq_cst) == nullptr)
+      return false;
+
+    return TrySchedule();
+  }
+
+ private:
+  /**
+   * @brief 回收不再使用的盒子，留作下一次放入使用；已有备用的盒子时直接释放
+   */
+  void Recycle(Box* box)
+  {
+    box->msg.reset();
+
+    Box* expected = nullptr;
+    if (not spare_.compare_exchange_strong(expected, box, std::memory_order_release, std::memory_order_relaxed))
+      delete box;
+  }
+
+ private:
+  // 最新的、尚未被处理的消息
+  std::atomic<Box*> latest_ = nullptr;
+
+  // 备用的空盒子
+  std::atomic<Box*> spare_ = nullptr;
+
+  // 是否已存在处理任务
+  std::atomic_bool scheduled_ = false;
+};
+}  // namespace aimrte::core::details
@@ -0,0 +1,105 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include "./block_pool.h"
+
+namespace aimrte::core::details
+{
+/**
+ * @brief 进程内的消息转换结果缓存，以原生消息地址为键，使同一条原生消息，
+ *        对同一种转换器（TConverter）仅转换一次，转换结果在多个订阅者之间共享。
+ *
+ * 转换结果持有原生消息的引用，只要缓存项有效，原生消息就不会被释放，其地址也不会被复用，
+ * 因此不会命中过期的结果。最后一个转换结果释放时，缓存项被移除。
+ *
+ * @tparam TRaw       原生的通信类型
+ * @tparam T          转换后的用户类型
+ * @tparam TConverter 转换器，仅用于区分缓存
+ */
+template <class TRaw, class T, class TConverter>
+class ConvertCache
+{
+  struct Entry {
+    // 转换来源，在转换结果有效期间保持原生消息存活
+    std::shared_ptr<const TRaw> src;
+
+    // 转换结果
+    std::shared_ptr<T> dst;
+
+    ~Entry()
+    {
+      Instance().Erase(src.get());
+    }
+  };
+
+  using Map = std::unordered_map<
+    const void*, std::weak_ptr<const T>, std::hash<const void*>, std::equal_to<>,
+    PoolAllocator<std::pair<const void* const, std::weak_ptr<const T>>>>;
+
+ public:
+  /**
+   * @return 本转换器的全局缓存，永不析构
+   */
+  static ConvertCache& Instance()
+  {
+    static auto* cache = new ConvertCache;
+    return *cache;
+  }
+
+  /**
+   * @brief 取出给定原生消息的转换结果，若不存在，则通过 convert 转换并缓存它。
+   * @param src     原生消息
+   * @param convert 转换过程，返回 std::shared_ptr<T>
+   */
+  template <class F>
+  std::shared_ptr<const T> GetOrConvert(const std::shared_ptr<const TRaw>& src, F&& convert)
+  {
+    const void* key = src.get();
+
+    {
+      const std::lock_guard lock(mutex_);
+      if (const auto it = entries_.find(key); it != entries_.end()) {
+        if (std::shared_ptr<const T> hit = it->second.lock())
+          return hit;
+      }
+    }
+
+    // 在锁外完成转换，若其他订阅者同时完成了转换，则使用先缓存的结果
+    const auto entry = std::allocate_shared<Entry>(PoolAllocator<Entry>(), src, std::forward<F>(convert)());
+    std::shared_ptr<const T> result(entry, entry->dst.get());
+
+    const std::lock_guard lock(mutex_);
+    const auto [it, inserted] = entries_.try_emplace(key, result);
+    if (not inserted) {
+      if (std::shared_ptr<const T> hit = it->second.lock())
+        return hit;
+
+      it->second = result;
+    }
+
+    return result;
+  }
+
+ private:
+  ConvertCache() = default;
+
+  /**
+   * @brief 移除已经失效的缓存项，若该键已被新的转换结果占用，则保留它
+   */
+  void Erase(const void* key)
+  {
+    const std::lock_guard lock(mutex_);
+    if (const auto it = entries_.find(key); it != entries_.end() and it->second.expired())
+      entries_.erase(it);
+  }
+
+ private:
+  std::mutex mutex_;
+  Map entries_;
+};
+}  // namespace aimrte::core::details
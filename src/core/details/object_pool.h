@@ -0,0 +1,94 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+#include "./block_pool.h"
+
+namespace aimrte::core::details
+{
+/**
+ * @brief 可回收对象池。取出的对象在最后一个引用释放后回到池中，下次取出时被原样复用，
+ *        其内部已申请的内存（如 std::vector 的容量）得以保留，避免大对象的反复申请与释放。
+ *
+ * @note 复用的对象保留着上一次的内容，使用者必须完整覆盖它。
+ * @note 本类仅可以通过 make_shared 创建。
+ */
+template <class T>
+class ObjectPool : public std::enable_shared_from_this<ObjectPool<T>>
+{
+ public:
+  /**
+   * @param capacity 池中最多保留的空闲对象数量
+   */
+  explicit ObjectPool(const std::size_t capacity)
+      : capacity_(capacity)
+  {
+    free_.reserve(capacity_);
+  }
+
+  ~ObjectPool()
+  {
+    for (T* ptr : free_)
+      delete ptr;
+  }
+
+  ObjectPool(const ObjectPool&)            = delete;
+  ObjectPool& operator=(const ObjectPool&) = delete;
+
+  /**
+   * @return 一个空闲对象，若池中没有空闲对象，将新建一个。
+   */
+  std::shared_ptr<T> Acquire()
+  {
+    T* ptr = nullptr;
+
+    {
+      const std::lock_guard lock(mutex_);
+      if (not free_.empty()) {
+        ptr = free_.back();
+        free_.pop_back();
+      }
+    }
+
+    if (ptr == nullptr)
+      ptr = new T();
+
+    return std::shared_ptr<T>(
+      ptr,
+      [pool = this->weak_from_this()](T* obj) {
+        if (const std::shared_ptr pool_ptr = pool.lock())
+          pool_ptr->Release(obj);
+        else
+          delete obj;
+      },
+      PoolAllocator<std::byte>());
+  }
+
+ private:
+  void Release(T* ptr)
+  {
+    {
+      const std::lock_guard lock(mutex_);
+      if (free_.size() < capacity_) {
+        free_.push_back(ptr);
+        return;
+      }
+    }
+
+    delete ptr;
+  }
+
+ private:
+  // 池中最多保留的空闲对象数量
+  const std::size_t capacity_;
+
+  std::mutex mutex_;
+
+  // 空闲对象
+  std::vector<T*> free_;
+};
+}  // namespace aimrte::core::details
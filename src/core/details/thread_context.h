@@ -6,7 +6,9 @@
 #include "src/interface/aimrt_module_cpp_interface/rpc/rpc_context.h"
 #include "src/panic/panic.h"
 #include "src/res/res.h"
+#include "./block_pool.h"
 #include <memory>
+#include <optional>
 
 namespace aimrte::core
 {
@@ -15,7 +17,7 @@ class Context;
 
 namespace aimrte::core::details
 {
-struct ThreadContext {
+struct ThreadContextData {
   // 模块的上下文
   std::weak_ptr<Context> ctx_ptr;
 
@@ -26,15 +28,71 @@ struct ThreadContext {
   std::optional<aimrt::rpc::ContextRef> active_rpc_context;
 };
 
+/**
+ * @brief 线程（或协程）的上下文信息，指向一份不可变的、引用计数的上下文数据。
+ *
+ * 上下文在创建时一次性构造，之后只以指针的形式传递：协程在创建时持有一份引用，
+ * 在每次唤醒时，仅当线程当前的上下文与之不同时才替换指针，从而避免了每次挂起与唤醒时
+ * 复制 weak_ptr 、执行器名称等数据的开销。需要修改上下文时，应当构造新的上下文并整体替换。
+ */
+class ThreadContext
+{
+ public:
+  ThreadContext() noexcept = default;
+
+  ThreadContext(
+    std::weak_ptr<Context> ctx_ptr,
+    res::Executor exe                                         = {},
+    std::optional<aimrt::rpc::ContextRef> active_rpc_context = std::nullopt)
+      : data_(std::allocate_shared<const ThreadContextData>(
+          PoolAllocator<ThreadContextData>{},
+          ThreadContextData{std::move(ctx_ptr), std::move(exe), std::move(active_rpc_context)}))
+  {
+  }
+
+  const ThreadContextData& operator*() const noexcept
+  {
+    return data_ != nullptr ? *data_ : kEmpty;
+  }
+
+  const ThreadContextData* operator->() const noexcept
+  {
+    return &**this;
+  }
+
+  /**
+   * @return 是否与给定的上下文指向同一份数据
+   */
+  [[nodiscard]] bool SameAs(const ThreadContext& other) const noexcept
+  {
+    return data_ == other.data_;
+  }
+
+ private:
+  // 空的上下文数据，供未设置上下文时读取
+  static inline const ThreadContextData kEmpty{};
+
+  std::shared_ptr<const ThreadContextData> data_;
+};
+
 inline thread_local ThreadContext g_thread_ctx;
 
+/**
+ * @brief 将当前线程切换到给定的上下文，若已经是同一份上下文数据，则不做任何事。
+ */
+inline void SwitchThreadContext(const ThreadContext& ctx)
+{
+  if (not g_thread_ctx.SameAs(ctx))
+    g_thread_ctx = ctx;
+}
+
 /**
  * @brief 取出当前的上下文数据，若上下文数据无效时，提示用户并报错退出程序
  * @return 有效的上下文数据
  */
 inline std::shared_ptr<Context> ExpectContext(const std::source_location& call_loc)
 {
-  const std::shared_ptr ctx_ptr = g_thread_ctx.ctx_ptr.lock();
+  const std::shared_ptr ctx_ptr = g_thread_ctx->ctx_ptr.lock();
 
   if (ctx_ptr != nullptr) [[likely]]
     return ctx_ptr;
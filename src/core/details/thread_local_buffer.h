@@ -0,0 +1,45 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <utility>
+
+namespace aimrte::core::details
+{
+/**
+ * @brief 每个线程、每种类型一份的可复用缓冲对象。
+ *        嵌套使用时（如在 inline 订阅回调中再次发布同一类型），内层将退回到临时对象。
+ */
+template <class T>
+class ThreadLocalBuffer
+{
+ public:
+  /**
+   * @brief 以本线程的缓冲对象调用 f ，f 的参数为 T&
+   */
+  template <class F>
+  static void Use(F&& f)
+  {
+    if (in_use_) [[unlikely]] {
+      T temp;
+      std::forward<F>(f)(temp);
+      return;
+    }
+
+    struct Guard {
+      Guard() { in_use_ = true; }
+      ~Guard() { in_use_ = false; }
+    } guard;
+
+    std::forward<F>(f)(buffer_);
+  }
+
+ private:
+  // 本线程的缓冲对象
+  inline static thread_local T buffer_;
+
+  // 本线程的缓冲对象是否正在被使用
+  inline static thread_local bool in_use_ = false;
+};
+}  // namespace aimrte::core::details
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "src/trait/trait.h"
+#include "./block_pool.h"
 #include "./concepts.h"
 
 namespace aimrte::core::details
@@ -82,4 +83,23 @@ std::shared_ptr<const T> MakeSharedMessage(const void* msg_raw_ptr, aimrt_functi
   // 返回该数据指针
   return msg_ptr;
 }
+
+/**
+ * @brief 与 MakeSharedMessage 相同，但数据指针的控制块从 BlockPool 中分配，消息释放后被回收复用
+ */
+template <class T>
+std::shared_ptr<const T> MakePooledSharedMessage(const void* msg_raw_ptr, aimrt_function_base_t* release_callback_base)
+{
+  // 负责释放数据内存的过程
+  aimrt::util::Function<aimrt_function_subscriber_release_callback_ops_t> release_callback(
+    release_callback_base);
+
+  // 构建数据指针，其析构时，负责将内存回收，控制块归还给内存池
+  return std::shared_ptr<const T>(
+    static_cast<const T*>(msg_raw_ptr),
+    [release_callback = std::move(release_callback)](const T*) {
+      release_callback();
+    },
+    PoolAllocator<std::byte>());
+}
 }  // namespace aimrte::core::details
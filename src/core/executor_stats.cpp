@@ -0,0 +1,123 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./executor_stats.h"
+#include <algorithm>
+#include <bit>
+#include <map>
+#include <mutex>
+
+namespace aimrte::core
+{
+namespace
+{
+std::mutex g_counters_mutex;
+
+// 启用了统计的执行器，及其计数器（在首次初始化该执行器时创建）
+std::map<std::string, std::shared_ptr<details::ExecutorCounter>, std::less<>> g_counters;
+
+// 按微秒数的二进制位数分桶
+std::size_t BucketOf(const std::int64_t ns)
+{
+  const std::uint64_t us = static_cast<std::uint64_t>(std::max<std::int64_t>(ns, 0)) / 1000;
+  return std::min<std::size_t>(std::bit_width(us), ExecutorStats::kLatencyBuckets - 1);
+}
+}  // namespace
+
+void EnableExecutorStats(std::string executor_name)
+{
+  const std::lock_guard lock(g_counters_mutex);
+  g_counters.try_emplace(std::move(executor_name));
+}
+
+std::vector<NamedExecutorStats> CollectExecutorStats()
+{
+  std::vector<NamedExecutorStats> result;
+
+  const std::lock_guard lock(g_counters_mutex);
+  result.reserve(g_counters.size());
+
+  for (const auto& [name, counter] : g_counters) {
+    if (counter != nullptr)
+      result.push_back({name, counter->Snapshot()});
+  }
+
+  return result;
+}
+}  // namespace aimrte::core
+
+namespace aimrte::core::details
+{
+std::chrono::steady_clock::time_point ExecutorCounter::OnEnqueue()
+{
+  enqueued.fetch_add(1, std::memory_order_relaxed);
+
+  const std::uint64_t current = depth.fetch_add(1, std::memory_order_relaxed) + 1;
+  for (std::uint64_t prev = max_depth.load(std::memory_order_relaxed);
+       current > prev and not max_depth.compare_exchange_weak(prev, current, std::memory_order_relaxed);) {
+  }
+
+  return std::chrono::steady_clock::now();
+}
+
+std::chrono::steady_clock::time_point ExecutorCounter::OnStart(const std::chrono::steady_clock::time_point enqueue_tp)
+{
+  const auto now = std::chrono::steady_clock::now();
+  const auto ns  = std::chrono::duration_cast<std::chrono::nanoseconds>(now - enqueue_tp).count();
+
+  depth.fetch_sub(1, std::memory_order_relaxed);
+  total_wait.fetch_add(ns, std::memory_order_relaxed);
+  wait_histogram[BucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+
+  return now;
+}
+
+void ExecutorCounter::OnFinish(const std::chrono::steady_clock::time_point start_tp)
+{
+  const auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - start_tp).count();
+
+  total_run.fetch_add(ns, std::memory_order_relaxed);
+  run_histogram[BucketOf(ns)].fetch_add(1, std::memory_order_relaxed);
+  executed.fetch_add(1, std::memory_order_relaxed);
+}
+
+void ExecutorCounter::OnDrop()
+{
+  depth.fetch_sub(1, std::memory_order_relaxed);
+  dropped.fetch_add(1, std::memory_order_relaxed);
+}
+
+ExecutorStats ExecutorCounter::Snapshot() const
+{
+  ExecutorStats stats{
+    .enqueued   = enqueued.load(std::memory_order_relaxed),
+    .executed   = executed.load(std::memory_order_relaxed),
+    .dropped    = dropped.load(std::memory_order_relaxed),
+    .depth      = depth.load(std::memory_order_relaxed),
+    .max_depth  = max_depth.load(std::memory_order_relaxed),
+    .total_wait = std::chrono::nanoseconds(total_wait.load(std::memory_order_relaxed)),
+    .total_run  = std::chrono::nanoseconds(total_run.load(std::memory_order_relaxed)),
+  };
+
+  for (std::size_t i = 0; i < ExecutorStats::kLatencyBuckets; ++i) {
+    stats.wait_histogram[i] = wait_histogram[i].load(std::memory_order_relaxed);
+    stats.run_histogram[i]  = run_histogram[i].load(std::memory_order_relaxed);
+  }
+
+  return stats;
+}
+
+std::shared_ptr<ExecutorCounter> GetExecutorCounter(const std::string& executor_name)
+{
+  const std::lock_guard lock(g_counters_mutex);
+
+  const auto it = g_counters.find(executor_name);
+  if (it == g_counters.end())
+    return nullptr;
+
+  if (it->second == nullptr)
+    it->second = std::make_shared<ExecutorCounter>();
+
+  return it->second;
+}
+}  // namespace aimrte::core::details
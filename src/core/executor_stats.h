@@ -0,0 +1,179 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace aimrte::core
+{
+/**
+ * @brief 为指定执行器启用任务统计：记录经由 OpExe::Post 投递的任务的排队情况、排队等待时间与运行时间。
+ *        未启用的执行器，投递路径上仅多一次空指针判断。
+ *
+ * @param executor_name 执行器名称
+ * @note 需要在模块初始化（即执行器被初始化）之前设置。
+ */
+void EnableExecutorStats(std::string executor_name);
+
+/**
+ * @brief 单个执行器的任务统计数据快照。
+ */
+struct ExecutorStats {
+  // 耗时直方图的桶数量：第 0 个桶为 [0, 1us) ，第 i 个桶为 [2^(i-1), 2^i) us ，最后一个桶不设上限
+  static constexpr std::size_t kLatencyBuckets = 18;
+
+  // 已投递的任务数量
+  std::uint64_t enqueued = 0;
+
+  // 已执行完毕的任务数量
+  std::uint64_t executed = 0;
+
+  // 未能开始执行就被丢弃的任务数量（如所在的 AsyncScope 已被停止）
+  std::uint64_t dropped = 0;
+
+  // 当前排队等待执行的任务数量，及其历史最大值
+  std::uint64_t depth     = 0;
+  std::uint64_t max_depth = 0;
+
+  // 排队等待时间（从投递到开始执行）的总和与直方图
+  std::chrono::nanoseconds total_wait{};
+  std::array<std::uint64_t, kLatencyBuckets> wait_histogram{};
+
+  // 运行时间（从开始执行到结束，协程包含其挂起的时间）的总和与直方图
+  std::chrono::nanoseconds total_run{};
+  std::array<std::uint64_t, kLatencyBuckets> run_histogram{};
+
+  /**
+   * @return 平均排队等待时间
+   */
+  [[nodiscard]] std::chrono::nanoseconds MeanWait() const
+  {
+    const std::uint64_t started = enqueued - depth - dropped;
+    return started == 0 ? std::chrono::nanoseconds{} : total_wait / static_cast<std::int64_t>(started);
+  }
+
+  /**
+   * @return 平均运行时间
+   */
+  [[nodiscard]] std::chrono::nanoseconds MeanRun() const
+  {
+    return executed == 0 ? std::chrono::nanoseconds{} : total_run / static_cast<std::int64_t>(executed);
+  }
+};
+
+/**
+ * @brief 带有执行器名称的任务统计数据，用于进程级的监控。
+ */
+struct NamedExecutorStats {
+  std::string name;
+  ExecutorStats stats;
+};
+
+/**
+ * @return 本进程内所有启用了统计的执行器的任务统计数据
+ */
+std::vector<NamedExecutorStats> CollectExecutorStats();
+}  // namespace aimrte::core
+
+namespace aimrte::core::details
+{
+/**
+ * @brief 单个执行器的任务统计计数器，由投递者与执行线程并发更新。
+ */
+struct ExecutorCounter {
+  std::atomic_uint64_t enqueued   = 0;
+  std::atomic_uint64_t executed   = 0;
+  std::atomic_uint64_t dropped    = 0;
+  std::atomic_uint64_t depth      = 0;
+  std::atomic_uint64_t max_depth  = 0;
+  std::atomic_int64_t total_wait  = 0;
+  std::atomic_int64_t total_run   = 0;
+  std::array<std::atomic_uint64_t, ExecutorStats::kLatencyBuckets> wait_histogram{};
+  std::array<std::atomic_uint64_t, ExecutorStats::kLatencyBuckets> run_histogram{};
+
+  /**
+   * @brief 记录一个任务被投递
+   * @return 投递的时间点，供任务开始执行时计算排队等待时间
+   */
+  std::chrono::steady_clock::time_point OnEnqueue();
+
+  /**
+   * @brief 记录一个任务开始执行
+   * @return 开始执行的时间点，供任务结束时计算运行时间
+   */
+  std::chrono::steady_clock::time_point OnStart(std::chrono::steady_clock::time_point enqueue_tp);
+
+  /**
+   * @brief 记录一个任务执行完毕
+   */
+  void OnFinish(std::chrono::steady_clock::time_point start_tp);
+
+  /**
+   * @brief 记录一个任务未能开始执行就被丢弃
+   */
+  void OnDrop();
+
+  [[nodiscard]] ExecutorStats Snapshot() const;
+};
+
+/**
+ * @brief 单个任务的统计守卫，在投递时创建，随任务的协程帧一同销毁。
+ *        无论任务是执行完毕，还是未开始执行就被丢弃，排队的计数都会被正确地归还。
+ */
+class ExecutorTaskGuard
+{
+ public:
+  explicit ExecutorTaskGuard(ExecutorCounter& counter)
+      : counter_(&counter), enqueue_tp_(counter.OnEnqueue())
+  {
+  }
+
+  ExecutorTaskGuard(ExecutorTaskGuard&& other) noexcept
+      : counter_(std::exchange(other.counter_, nullptr)), enqueue_tp_(other.enqueue_tp_), start_tp_(other.start_tp_)
+  {
+  }
+
+  ExecutorTaskGuard(const ExecutorTaskGuard&)            = delete;
+  ExecutorTaskGuard& operator=(const ExecutorTaskGuard&) = delete;
+  ExecutorTaskGuard& operator=(ExecutorTaskGuard&&)      = delete;
+
+  ~ExecutorTaskGuard()
+  {
+    if (counter_ == nullptr)
+      return;
+
+    if (start_tp_.has_value())
+      counter_->OnFinish(*start_tp_);
+    else
+      counter_->OnDrop();
+  }
+
+  /**
+   * @brief 记录任务开始执行
+   */
+  void Start()
+  {
+    start_tp_ = counter_->OnStart(enqueue_tp_);
+  }
+
+ private:
+  ExecutorCounter* counter_;
+  std::chrono::steady_clock::time_point enqueue_tp_;
+  std::optional<std::chrono::steady_clock::time_point> start_tp_;
+};
+
+/**
+ * @return 指定执行器的任务统计计数器，该执行器未启用统计时返回空指针。
+ *         同名执行器在进程内共享同一个计数器，计数器在进程退出前一直有效。
+ */
+std::shared_ptr<ExecutorCounter> GetExecutorCounter(const std::string& executor_name);
+}  // namespace aimrte::core::details
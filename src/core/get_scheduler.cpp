@@ -5,10 +5,23 @@
 
 namespace aimrte::core::details
 {
+aimrt::executor::ExecutorRef GetExecutor(const res::Executor& exe, std::source_location loc)
+{
+  return Context::OpExe::GetRawRef(ExpectContext(loc)->exe(exe));
+}
+
 aimrt::co::AimRTScheduler GetScheduler(const res::Executor& exe, std::source_location loc)
 {
-  return aimrt::co::AimRTScheduler(
-    Context::OpExe::GetRawRef(
-      ExpectContext(loc)->exe(exe)));
+  return aimrt::co::AimRTScheduler(GetExecutor(exe, loc));
+}
+
+TimerWheel* GetTimerWheel(const res::Executor& exe, std::source_location loc)
+{
+  return Context::OpExe::GetTimerWheel(ExpectContext(loc)->exe(exe));
+}
+
+bool IsInExecutor(const res::Executor& exe, std::source_location loc)
+{
+  return Context::OpExe::GetRawRef(ExpectContext(loc)->exe(exe)).IsInCurrentExecutor();
 }
 }  // namespace aimrte::core::details
@@ -7,8 +7,23 @@
 
 namespace aimrte::core::details
 {
+/**
+ * @brief 从当前模块上下文中，获取指定执行器的原生句柄，可在之后于任意线程上直接投递任务
+ */
+aimrt::executor::ExecutorRef GetExecutor(const res::Executor& exe, std::source_location loc);
+
 /**
  * @brief 从当前模块上下文中，获取指定执行器的调度器
  */
 aimrt::co::AimRTScheduler GetScheduler(const res::Executor& exe, std::source_location loc);
+
+/**
+ * @brief 从当前模块上下文中，获取指定执行器的时间轮，未启用时返回空指针
+ */
+TimerWheel* GetTimerWheel(const res::Executor& exe, std::source_location loc);
+
+/**
+ * @return 当前线程是否属于指定的执行器
+ */
+bool IsInExecutor(const res::Executor& exe, std::source_location loc);
 }  // namespace aimrte::core::details
@@ -0,0 +1,90 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./intra_process.h"
+
+namespace aimrte::core
+{
+void EnableIntraProcessTopic(std::string topic_name)
+{
+  details::IntraProcessBus::Instance().Enable(std::move(topic_name));
+}
+
+bool IsIntraProcessTopic(const std::string_view topic_name)
+{
+  return details::IntraProcessBus::Instance().Find(topic_name) != nullptr;
+}
+}  // namespace aimrte::core
+
+namespace aimrte::core::details
+{
+IntraProcessTopic::IntraProcessTopic(std::string name)
+    : name_(std::move(name)), callbacks_(std::make_shared<const std::vector<Callback>>())
+{
+}
+
+const std::string& IntraProcessTopic::Name() const
+{
+  return name_;
+}
+
+bool IntraProcessTopic::BindType(const std::type_index type)
+{
+  const std::lock_guard lock(mutex_);
+
+  if (not type_.has_value())
+    type_ = type;
+
+  return *type_ == type;
+}
+
+void IntraProcessTopic::Subscribe(Callback callback)
+{
+  const std::lock_guard lock(mutex_);
+
+  auto callbacks = std::make_shared<std::vector<Callback>>(*callbacks_);
+  callbacks->push_back(std::move(callback));
+  callbacks_ = std::move(callbacks);
+}
+
+void IntraProcessTopic::Publish(const std::shared_ptr<const void>& msg) const
+{
+  std::shared_ptr<const std::vector<Callback>> callbacks;
+
+  {
+    const std::lock_guard lock(mutex_);
+    callbacks = callbacks_;
+  }
+
+  for (const Callback& callback : *callbacks)
+    callback(msg);
+}
+
+IntraProcessBus& IntraProcessBus::Instance()
+{
+  static IntraProcessBus instance;
+  return instance;
+}
+
+void IntraProcessBus::Enable(std::string topic_name)
+{
+  const std::lock_guard lock(mutex_);
+
+  if (topics_.contains(topic_name))
+    return;
+
+  auto topic = std::make_shared<IntraProcessTopic>(topic_name);
+  topics_.emplace(std::move(topic_name), std::move(topic));
+}
+
+std::shared_ptr<IntraProcessTopic> IntraProcessBus::Find(const std::string_view topic_name) const
+{
+  const std::lock_guard lock(mutex_);
+
+  const auto it = topics_.find(topic_name);
+  if (it == topics_.end())
+    return nullptr;
+
+  return it->second;
+}
+}  // namespace aimrte::core::details
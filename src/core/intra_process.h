@@ -0,0 +1,104 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <typeindex>
+#include <vector>
+
+namespace aimrte::core
+{
+/**
+ * @brief 为指定话题启用进程内通信。该话题的发布与订阅将不再经过原生通信后端，
+ *        订阅者直接共享发布者给出的对象，不经过序列化与拷贝。
+ *
+ * @note 需要在模块初始化之前设置。进程外的订阅者、以及 record 等后端将无法收到该话题的数据；
+ *       该话题的所有发布者与订阅者，必须使用同一种用户类型。
+ */
+void EnableIntraProcessTopic(std::string topic_name);
+
+/**
+ * @return 指定话题是否启用了进程内通信
+ */
+bool IsIntraProcessTopic(std::string_view topic_name);
+}  // namespace aimrte::core
+
+namespace aimrte::core::details
+{
+/**
+ * @brief 单个话题的进程内信道，维护该话题的订阅回调，发布时将消息对象共享给所有订阅者。
+ *        订阅回调仅在初始化阶段添加，发布时取出回调列表的快照，不在锁内执行回调。
+ */
+class IntraProcessTopic
+{
+ public:
+  using Callback = std::function<void(const std::shared_ptr<const void>&)>;
+
+  explicit IntraProcessTopic(std::string name);
+
+  IntraProcessTopic(const IntraProcessTopic&)            = delete;
+  IntraProcessTopic& operator=(const IntraProcessTopic&) = delete;
+
+  /**
+   * @return 话题名称
+   */
+  [[nodiscard]] const std::string& Name() const;
+
+  /**
+   * @brief 绑定本话题的消息类型，首次调用时记录类型
+   * @return 给定类型是否与已绑定的类型一致
+   */
+  bool BindType(std::type_index type);
+
+  /**
+   * @brief 添加一个订阅回调，回调的参数为发布时的消息对象，需由订阅者还原为绑定的类型。
+   */
+  void Subscribe(Callback callback);
+
+  /**
+   * @brief 将消息对象共享给所有订阅者
+   */
+  void Publish(const std::shared_ptr<const void>& msg) const;
+
+ private:
+  const std::string name_;
+
+  mutable std::mutex mutex_;
+
+  // 本话题绑定的消息类型
+  std::optional<std::type_index> type_;
+
+  // 订阅回调列表，添加时整体替换，发布时共享持有其快照
+  std::shared_ptr<const std::vector<Callback>> callbacks_;
+};
+
+/**
+ * @brief 进程级的进程内信道集合。
+ */
+class IntraProcessBus
+{
+ public:
+  static IntraProcessBus& Instance();
+
+  /**
+   * @brief 为指定话题启用进程内通信
+   */
+  void Enable(std::string topic_name);
+
+  /**
+   * @return 指定话题的进程内信道，若该话题未启用进程内通信，返回空指针
+   */
+  [[nodiscard]] std::shared_ptr<IntraProcessTopic> Find(std::string_view topic_name) const;
+
+ private:
+  mutable std::mutex mutex_;
+  std::map<std::string, std::shared_ptr<IntraProcessTopic>, std::less<>> topics_;
+};
+}  // namespace aimrte::core::details
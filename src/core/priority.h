@@ -0,0 +1,34 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+namespace aimrte::core
+{
+/**
+ * @brief 投递到执行器的任务优先级。仅对支持优先级的执行器（如 priority_thread）生效，
+ *        其中高优先级的任务总是先于已排队的低优先级任务执行；其他执行器忽略该值。
+ */
+enum class Priority : std::uint8_t {
+  Low,
+  Normal,
+  High,
+};
+
+// 优先级的数量
+inline constexpr std::size_t kPriorityCount = 3;
+}  // namespace aimrte::core
+
+namespace aimrte::core::details
+{
+/**
+ * @brief 当前线程上正在经由 OpExe::Post 投递的任务的优先级，仅在投递期间有值。
+ *        支持优先级的执行器在接收任务时读取并清除它；执行任务期间不会设置它，
+ *        因此不会影响任务中的其他投递，也不会流向其他执行器。
+ */
+inline thread_local std::optional<Priority> g_post_priority;
+}  // namespace aimrte::core::details
@@ -0,0 +1,16 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+namespace aimrte::core
+{
+/**
+ * @brief 单个发布信道的可选配置，在初始化发布信道时给定。
+ */
+struct PublishOption {
+  // 仅对带有转换器的发布信道有效：转换后的通信类型对象使用线程本地的缓冲区，
+  // 跨越多次发布复用其已申请的内存。转换函数必须完整覆盖目标对象。
+  bool reuse_buffer = false;
+};
+}  // namespace aimrte::core
@@ -0,0 +1,69 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+
+namespace aimrte::core
+{
+/**
+ * @brief 订阅队列已满时，对新到来消息的处理策略。
+ */
+enum class QueuePolicy {
+  // 丢弃队列中最旧的待处理消息，为新消息腾出位置
+  DropOldest,
+
+  // 丢弃新到来的消息
+  DropNewest,
+
+  // 阻塞原生通信回调直到队列有空位，对进程内（local 后端）的发布将阻塞发布者。
+  // 等待由处理任务取出消息时唤醒，超过 QueueOption::block_timeout 、或模块被要求退出时，丢弃新到来的消息。
+  // 处理任务的执行器与后端的投递共用线程时（如单线程执行器），处理任务在阻塞期间无法运行，
+  // 每条溢出的消息都将等满超时后被丢弃，此时应改用丢弃策略。
+  Block,
+};
+
+/**
+ * @brief 执行器上订阅的待处理消息队列配置。
+ */
+struct QueueOption {
+  // 队列中最多容纳的待处理消息数量，为 0 时不限制
+  std::size_t depth = 0;
+
+  // 队列已满时的处理策略
+  QueuePolicy policy = QueuePolicy::DropOldest;
+
+  // 阻塞策略下的最长等待时间。原生回调与处理任务共用线程时，阻塞可能无法被解除，
+  // 超时丢弃可以保证通信线程总能恢复。
+  std::chrono::milliseconds block_timeout{100};
+};
+
+/**
+ * @brief 单个订阅的可选配置，在注册订阅回调时给定。
+ */
+struct SubscribeOption {
+  // 是否使用池化的消息分发过程：消息句柄的控制块从内存池回收复用，
+  // 在执行器上回调时，不再额外包装协程与复制回调函数，适用于高频话题。
+  bool pooled = false;
+
+  // 是否合并消息，仅对执行器上的订阅有效：每个订阅至多保留一条待处理的最新消息，
+  // 新消息将无锁地替换掉尚未处理的旧消息（计入丢弃数量），且至多存在一个处理任务。
+  // 适用于只关心最新状态的话题。
+  bool conflate = false;
+
+  // 待处理消息的队列配置，仅对执行器上的订阅有效：限制排队等待处理的消息数量，
+  // 队列满时按策略丢弃或阻塞（丢弃的计入丢弃数量），且至多存在一个处理任务，消息按序处理。
+  // 未设置深度时，使用初始化订阅信道时给定的配置。与 conflate 同时开启时，conflate 优先。
+  QueueOption queue;
+
+  // 仅对带有转换器的订阅有效：同一条原生消息，对同一种转换器仅转换一次，
+  // 转换结果在所有开启本选项的订阅者之间共享。
+  bool share_converted = false;
+
+  // 仅对带有转换器的订阅有效：回收转换结果对象，最多保留的空闲对象数量，为 0 时不回收。
+  // 复用的对象保留着上一次的内容（及其已申请的内存），转换函数必须完整覆盖目标对象。
+  std::size_t recycle_converted = 0;
+};
+}  // namespace aimrte::core
@@ -0,0 +1,50 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./subscribe_stats.h"
+#include <mutex>
+
+namespace aimrte::core
+{
+namespace
+{
+struct CounterEntry {
+  std::string topic_name;
+  std::weak_ptr<details::SubscribeCounter> counter;
+};
+
+std::mutex g_counters_mutex;
+std::vector<CounterEntry> g_counters;
+}  // namespace
+
+std::vector<TopicSubscribeStats> CollectSubscribeStats()
+{
+  std::vector<TopicSubscribeStats> result;
+
+  const std::lock_guard lock(g_counters_mutex);
+  result.reserve(g_counters.size());
+
+  // 收集存活的计数器，并顺带清理已经释放的
+  std::erase_if(
+    g_counters,
+    [&](const CounterEntry& entry) {
+      const std::shared_ptr counter = entry.counter.lock();
+      if (counter == nullptr)
+        return true;
+
+      result.push_back({entry.topic_name, counter->Snapshot()});
+      return false;
+    });
+
+  return result;
+}
+}  // namespace aimrte::core
+
+namespace aimrte::core::details
+{
+void RegisterSubscribeCounter(std::string topic_name, std::weak_ptr<SubscribeCounter> counter)
+{
+  const std::lock_guard lock(g_counters_mutex);
+  g_counters.push_back({std::move(topic_name), std::move(counter)});
+}
+}  // namespace aimrte::core::details
@@ -0,0 +1,77 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace aimrte::core
+{
+/**
+ * @brief 单个订阅的统计数据快照。
+ */
+struct SubscribeStats {
+  // 收到的消息数量
+  std::uint64_t received = 0;
+
+  // 未被处理、即被丢弃的消息数量
+  std::uint64_t dropped = 0;
+
+  // 当前排队等待处理的消息数量（仅有界队列模式）
+  std::uint64_t queued = 0;
+
+  // 队列的容量，为 0 时表示未限制
+  std::uint64_t capacity = 0;
+
+  // 因队列已满而阻塞原生回调的次数（仅 QueuePolicy::Block 策略）
+  std::uint64_t blocked = 0;
+};
+
+/**
+ * @brief 带有话题名称的订阅统计数据，用于进程级的监控。
+ */
+struct TopicSubscribeStats {
+  std::string topic_name;
+  SubscribeStats stats;
+};
+
+/**
+ * @return 本进程内所有仍然存活的订阅的统计数据
+ */
+std::vector<TopicSubscribeStats> CollectSubscribeStats();
+}  // namespace aimrte::core
+
+namespace aimrte::core::details
+{
+/**
+ * @brief 单个订阅的统计计数器，由订阅回调与分发过程并发更新。
+ */
+struct SubscribeCounter {
+  std::atomic_uint64_t received = 0;
+  std::atomic_uint64_t dropped  = 0;
+  std::atomic_uint64_t queued   = 0;
+  std::atomic_uint64_t capacity = 0;
+  std::atomic_uint64_t blocked  = 0;
+
+  [[nodiscard]] SubscribeStats Snapshot() const
+  {
+    return {
+      .received = received.load(std::memory_order_relaxed),
+      .dropped  = dropped.load(std::memory_order_relaxed),
+      .queued   = queued.load(std::memory_order_relaxed),
+      .capacity = capacity.load(std::memory_order_relaxed),
+      .blocked  = blocked.load(std::memory_order_relaxed),
+    };
+  }
+};
+
+/**
+ * @brief 登记一个订阅的统计计数器，以便通过 CollectSubscribeStats 进行监控。
+ *        计数器被弱引用，订阅释放后自动移除。
+ */
+void RegisterSubscribeCounter(std::string topic_name, std::weak_ptr<SubscribeCounter> counter);
+}  // namespace aimrte::core::details
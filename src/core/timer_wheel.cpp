@@ -0,0 +1,252 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./timer_wheel.h"
+#include <algorithm>
+#include <utility>
+
+namespace aimrte::core
+{
+void EnableTimerWheel(std::string executor_name, const std::chrono::nanoseconds tick)
+{
+  details::TimerWheelRegistry::Instance().Enable(std::move(executor_name), tick);
+}
+}  // namespace aimrte::core
+
+namespace aimrte::core::details
+{
+TimerWheel::TimerWheel(const aimrt::executor::ExecutorRef executor, const std::chrono::nanoseconds tick)
+    : executor_(executor), tick_(tick), origin_(std::chrono::steady_clock::now())
+{
+}
+
+std::chrono::nanoseconds TimerWheel::Tick() const
+{
+  return tick_;
+}
+
+std::size_t TimerWheel::Size()
+{
+  const std::lock_guard lock(mutex_);
+  return size_;
+}
+
+std::uint64_t TimerWheel::TickOf(const std::chrono::steady_clock::time_point tp) const
+{
+  return tp <= origin_ ? 0 : static_cast<std::uint64_t>((tp - origin_) / tick_);
+}
+
+void TimerWheel::Add(Node* node, const std::chrono::steady_clock::time_point deadline)
+{
+  const std::lock_guard lock(mutex_);
+
+  // 空闲的时间轮不推进时间，在新的等待者到来时，直接对齐到当前时间
+  if (size_ == 0)
+    current_ = std::max(current_, TickOf(std::chrono::steady_clock::now()));
+
+  // 向上取整，保证不会早于截止时间被唤醒
+  node->expire = std::max(TickOf(deadline - std::chrono::nanoseconds(1)) + 1, current_ + 1);
+
+  Node* due = nullptr;
+  ++size_;
+
+  // 新节点所在槽位早于已申请的定时任务被处理时，才需要提前申请
+  Arm(Place(node, due));
+}
+
+void TimerWheel::Schedule(Node* node, const std::chrono::steady_clock::duration duration)
+{
+  Add(node, std::chrono::steady_clock::now() + duration);
+}
+
+bool TimerWheel::Cancel(Node* node)
+{
+  const std::lock_guard lock(mutex_);
+
+  if (node->link == nullptr)
+    return false;
+
+  *node->link = node->next;
+  if (node->next != nullptr)
+    node->next->link = node->link;
+
+  node->link = nullptr;
+  --size_;
+
+  // 时间轮变空后，已申请的定时任务到来时不再申请下一个
+  return true;
+}
+
+std::uint64_t TimerWheel::Place(Node* node, Node*& due)
+{
+  if (node->expire <= current_) {
+    node->link = nullptr;
+    node->next = due;
+    due        = node;
+    --size_;
+    return 0;
+  }
+
+  const std::uint64_t delta = node->expire - current_;
+
+  std::size_t level = 0;
+  while (level + 1 < kLevels and delta >= (std::uint64_t{1} << (kSlotBits * (level + 1))))
+    ++level;
+
+  // 超出时间轮范围的节点，先挂在最高层最远的槽位上，下放时会被重新放置
+  const std::uint64_t range  = std::uint64_t{1} << (kSlotBits * kLevels);
+  const std::uint64_t expire = delta < range ? node->expire : current_ + range - 1;
+
+  Node*& slot = slots_[level][(expire >> (kSlotBits * level)) & (kSlots - 1)];
+  if (slot != nullptr)
+    slot->link = &node->next;
+
+  node->next = slot;
+  node->link = &slot;
+  slot       = node;
+
+  // 高层槽位在其起始的 tick 被下放
+  return (expire >> (kSlotBits * level)) << (kSlotBits * level);
+}
+
+TimerWheel::Node* TimerWheel::AdvanceTo(const std::uint64_t tick)
+{
+  Node* due = nullptr;
+
+  while (current_ < tick and size_ > 0) {
+    // 跳过没有任何槽位需要处理的 tick
+    const std::uint64_t next = NextEventTick();
+    if (next > tick)
+      break;
+
+    current_ = next;
+
+    // 从最高的、恰好转过一圈的层开始，逐级将槽位中的节点下放
+    std::size_t wrapped = 0;
+    while (wrapped + 1 < kLevels and (current_ & ((std::uint64_t{1} << (kSlotBits * (wrapped + 1))) - 1)) == 0)
+      ++wrapped;
+
+    for (std::size_t level = wrapped; level > 0; --level) {
+      Node*& slot = slots_[level][(current_ >> (kSlotBits * level)) & (kSlots - 1)];
+      for (Node* node = std::exchange(slot, nullptr); node != nullptr;) {
+        Node* next = node->next;
+        Place(node, due);
+        node = next;
+      }
+    }
+
+    // 最底层当前槽位中的节点全部到期
+    for (Node* node = std::exchange(slots_[0][current_ & (kSlots - 1)], nullptr); node != nullptr;) {
+      Node* next = node->next;
+      node->link = nullptr;
+      node->next = due;
+      due        = node;
+      node       = next;
+      --size_;
+    }
+  }
+
+  // 在给定的 tick 之前已没有需要处理的槽位，直接跳到给定的 tick
+  current_ = std::max(current_, tick);
+  return due;
+}
+
+std::uint64_t TimerWheel::NextEventTick() const
+{
+  std::uint64_t next = kNotArmed;
+
+  // 各层中，从当前位置起第一个非空的槽位，即为该层下一个需要处理的 tick
+  for (std::size_t level = 0; level < kLevels; ++level) {
+    const std::size_t   shift = kSlotBits * level;
+    const std::uint64_t base  = current_ >> shift;
+
+    for (std::uint64_t k = 1; k <= kSlots; ++k) {
+      if (slots_[level][(base + k) & (kSlots - 1)] != nullptr) {
+        next = std::min(next, (base + k) << shift);
+        break;
+      }
+    }
+  }
+
+  return next;
+}
+
+void TimerWheel::Arm(const std::uint64_t tick)
+{
+  if (tick >= armed_)
+    return;
+
+  armed_ = tick;
+
+  // 对齐到 tick 的边界，避免累计误差
+  const auto next_tp = origin_ + tick_ * tick;
+
+  executor_.ExecuteAfter(
+    std::max(std::chrono::duration_cast<std::chrono::nanoseconds>(next_tp - std::chrono::steady_clock::now()), std::chrono::nanoseconds(0)),
+    [self = shared_from_this(), tick]() { self->OnTick(tick); });
+}
+
+void TimerWheel::OnTick(const std::uint64_t tick)
+{
+  Node* due = nullptr;
+
+  {
+    const std::lock_guard lock(mutex_);
+
+    // 执行器可能略早于 tick 的边界调度本任务，此时仍按该 tick 处理，避免反复申请
+    due = AdvanceTo(std::max(TickOf(std::chrono::steady_clock::now()), tick));
+
+    // 被更早的定时任务取代的定时任务到来时，只推进时间，不影响已申请的定时任务
+    if (tick == armed_)
+      armed_ = kNotArmed;
+
+    if (size_ > 0)
+      Arm(NextEventTick());
+  }
+
+  // 在锁外、在本执行器上依次唤醒到期的协程
+  while (due != nullptr) {
+    Node* next = due->next;
+
+    if (due->callback != nullptr)
+      due->callback(due);
+    else
+      due->handle.resume();
+
+    due = next;
+  }
+}
+
+TimerWheelRegistry& TimerWheelRegistry::Instance()
+{
+  static TimerWheelRegistry instance;
+  return instance;
+}
+
+void TimerWheelRegistry::Enable(std::string executor_name, const std::chrono::nanoseconds tick)
+{
+  const std::lock_guard lock(mutex_);
+  ticks_.insert_or_assign(std::move(executor_name), tick);
+}
+
+std::shared_ptr<TimerWheel> TimerWheelRegistry::Get(const aimrt::executor::ExecutorRef executor)
+{
+  if (not executor or not executor.SupportTimerSchedule())
+    return nullptr;
+
+  const std::lock_guard lock(mutex_);
+
+  const auto it = ticks_.find(executor.Name());
+  if (it == ticks_.end() or it->second.count() <= 0)
+    return nullptr;
+
+  // 同一执行器上的各个上下文共享时间轮，所有上下文都释放后，再次获取时重新创建
+  std::weak_ptr<TimerWheel>& slot = wheels_[executor.NativeHandle()];
+  if (std::shared_ptr<TimerWheel> wheel = slot.lock(); wheel != nullptr)
+    return wheel;
+
+  auto wheel = std::make_shared<TimerWheel>(executor, it->second);
+  slot       = wheel;
+  return wheel;
+}
+}  // namespace aimrte::core::details
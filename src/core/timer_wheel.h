@@ -0,0 +1,182 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <coroutine>
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include "src/interface/aimrt_module_cpp_interface/executor/executor.h"
+
+namespace aimrte::core
+{
+/**
+ * @brief 为指定执行器启用分层时间轮。该执行器上的 ctx::Sleep （以及基于它的 ctx::Loop 等）
+ *        不再为每个协程单独向执行器申请定时任务，而是挂到时间轮上，由时间轮按给定的精度批量唤醒。
+ *
+ * @param executor_name 执行器名称，该执行器须支持定时调度
+ * @param tick          时间轮的精度，睡眠的协程至多延迟一个 tick 被唤醒
+ * @note 需要在模块初始化（即执行器被初始化）之前设置。
+ */
+void EnableTimerWheel(std::string executor_name, std::chrono::nanoseconds tick);
+}  // namespace aimrte::core
+
+namespace aimrte::core::details
+{
+/**
+ * @brief 单个执行器上的分层时间轮。
+ *
+ * 共 kLevels 层，每层 kSlots 个槽位，第 l 层的一个槽位覆盖 kSlots^l 个 tick 。
+ * 等待的协程以侵入式节点的形式挂在槽位上（节点位于协程帧中，无需额外的内存申请），
+ * 时间轮仅在存在等待者时，向执行器申请一次定时任务，其时间点为下一个有节点的槽位需要被处理的 tick
+ * （最底层槽位的到期，或高层槽位的下放），而非每个 tick 都申请；在其中推进时间、跳过空的 tick 、
+ * 将高层槽位逐级下放，并在执行器上依次唤醒所有到期的协程。
+ * 同一个执行器上的时间轮，由使用该执行器的各个上下文共享。
+ */
+class TimerWheel : public std::enable_shared_from_this<TimerWheel>
+{
+ public:
+  static constexpr std::size_t kSlotBits = 6;
+  static constexpr std::size_t kSlots    = 1 << kSlotBits;
+  static constexpr std::size_t kLevels   = 4;
+
+  // 等待中的协程，或到期时执行的回调
+  struct Node {
+    std::uint64_t expire = 0;
+    Node* next           = nullptr;
+
+    // 指向本节点的指针所在的位置，用于撤销；不在槽位中（已经到期）时为空
+    Node** link = nullptr;
+
+    std::coroutine_handle<> handle;
+
+    // 不为空时，到期后调用它，而不是恢复协程
+    void (*callback)(Node* node) = nullptr;
+  };
+
+  // 在时间轮上睡眠的等待体
+  struct SleepAwaiter {
+    TimerWheel& wheel;
+    std::chrono::steady_clock::time_point deadline;
+    Node node{};
+
+    bool await_ready() const noexcept
+    {
+      return deadline <= std::chrono::steady_clock::now();
+    }
+
+    void await_suspend(const std::coroutine_handle<> handle)
+    {
+      node.handle = handle;
+      wheel.Add(&node, deadline);
+    }
+
+    constexpr void await_resume() const noexcept {}
+  };
+
+  TimerWheel(aimrt::executor::ExecutorRef executor, std::chrono::nanoseconds tick);
+
+  TimerWheel(const TimerWheel&)            = delete;
+  TimerWheel& operator=(const TimerWheel&) = delete;
+
+  /**
+   * @return 在时间轮上睡眠给定时长的等待体，协程将在所属执行器上被唤醒
+   */
+  [[nodiscard]] SleepAwaiter Sleep(const std::chrono::steady_clock::duration duration)
+  {
+    return {*this, std::chrono::steady_clock::now() + duration};
+  }
+
+  /**
+   * @brief 在给定时长之后，于所属执行器上调用节点的回调。节点须保持有效，直到回调被调用或撤销成功
+   */
+  void Schedule(Node* node, std::chrono::steady_clock::duration duration);
+
+  /**
+   * @brief 撤销尚未到期的节点
+   * @return 是否撤销成功；节点已经到期（其回调即将或正在被调用）时返回 false
+   */
+  bool Cancel(Node* node);
+
+  /**
+   * @return 时间轮的精度
+   */
+  [[nodiscard]] std::chrono::nanoseconds Tick() const;
+
+  /**
+   * @return 尚未到期的节点数量
+   */
+  [[nodiscard]] std::size_t Size();
+
+ private:
+  void Add(Node* node, std::chrono::steady_clock::time_point deadline);
+
+  // 将节点放到对应的槽位上，已经到期的节点放入 due 链表。须持有锁
+  // 返回该槽位下一次被处理的 tick ，节点已经到期时返回 0
+  std::uint64_t Place(Node* node, Node*& due);
+
+  // 推进到给定的 tick ，收集所有到期的节点。须持有锁
+  Node* AdvanceTo(std::uint64_t tick);
+
+  // 下一个有节点的槽位需要被处理的 tick ，时间轮为空时返回 kNotArmed 。须持有锁
+  [[nodiscard]] std::uint64_t NextEventTick() const;
+
+  // 若给定的 tick 早于已申请的定时任务，则向执行器为它申请一次定时任务。须持有锁
+  void Arm(std::uint64_t tick);
+
+  void OnTick(std::uint64_t tick);
+
+  [[nodiscard]] std::uint64_t TickOf(std::chrono::steady_clock::time_point tp) const;
+
+ private:
+  const aimrt::executor::ExecutorRef executor_;
+  const std::chrono::nanoseconds tick_;
+  const std::chrono::steady_clock::time_point origin_;
+
+  std::mutex mutex_;
+
+  // 已经处理过的 tick
+  std::uint64_t current_ = 0;
+
+  // 各层的槽位，每个槽位是一个单向链表
+  std::array<std::array<Node*, kSlots>, kLevels> slots_{};
+
+  // 等待中的节点数量
+  std::size_t size_ = 0;
+
+  // 已向执行器申请的、最早的定时任务所在的 tick
+  static constexpr std::uint64_t kNotArmed = UINT64_MAX;
+  std::uint64_t armed_                     = kNotArmed;
+};
+
+/**
+ * @brief 记录进程内启用了时间轮的执行器，并在模块初始化执行器时，为其创建或取得时间轮。
+ */
+class TimerWheelRegistry
+{
+ public:
+  static TimerWheelRegistry& Instance();
+
+  void Enable(std::string executor_name, std::chrono::nanoseconds tick);
+
+  /**
+   * @return 指定执行器的时间轮，在仍然使用它的上下文之间共享；若未启用、或执行器不支持定时调度，返回空指针
+   */
+  std::shared_ptr<TimerWheel> Get(aimrt::executor::ExecutorRef executor);
+
+ private:
+  TimerWheelRegistry() = default;
+
+ private:
+  std::mutex mutex_;
+  std::map<std::string, std::chrono::nanoseconds, std::less<>> ticks_;
+
+  // 按执行器的原生句柄索引的时间轮，由使用它的上下文持有
+  std::map<const void*, std::weak_ptr<TimerWheel>> wheels_;
+};
+}  // namespace aimrte::core::details
@@ -48,4 +48,9 @@ bool Ok(const std::source_location call_loc)
 {
   return core::details::ExpectContext(call_loc)->Ok();
 }
+
+core::CancelToken ShutdownToken(const std::source_location call_loc)
+{
+  return core::details::ExpectContext(call_loc)->ShutdownToken();
+}
 }  // namespace aimrte::ctx
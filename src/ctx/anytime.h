@@ -57,6 +57,11 @@ const std::filesystem::path& GetTempPath(AIMRTE(src(call_loc)));
  */
 bool Ok(AIMRTE(src(call_loc)));
 
+/**
+ * @return 当前模块的退出令牌，在模块被要求退出时取消，可传给同步原语的等待接口，使退出时不再无限期地等待
+ */
+core::CancelToken ShutdownToken(AIMRTE(src(call_loc)));
+
 /**
  * @brief 没有上下文的情况下，日志接口的实现
  */
@@ -80,7 +85,7 @@ void DefaultLogImpl(const std::uint32_t level, const std::source_location& src_l
 // 一些 log 宏，使用宏可以避免在等级不够时，节省日志内容的计算
 #define AIMRTE_DETAILS_LOG_IMPL(_level_, _src_loc_, ...)                                                            \
   do {                                                                                                              \
-    if (!aimrte::core::details::g_thread_ctx.ctx_ptr.expired()) {                                                   \
+    if (!aimrte::core::details::g_thread_ctx->ctx_ptr.expired()) {                                                  \
       if (auto op = ::aimrte::ctx::log(_src_loc_); op.GetLevel() <= ::aimrte::core::Context::OpLog::_level_##Level) \
         op._level_(__VA_ARGS__);                                                                                    \
     } else {                                                                                                        \
@@ -46,7 +46,9 @@ inline ctx::Executor& ThreadSafeExecutor(ctx::Executor& res, const std::string_v
 template <core::concepts::DirectlySupportedType T>
 [[nodiscard]] ctx::Publisher<T> Publisher(const std::string_view& topic_name, AIMRTE(src(loc)))
 {
-  return {core::details::ExpectContext(loc)->pub(loc).Init<T>(topic_name)};
+  const std::shared_ptr<core::Context> ctx_ptr = core::details::ExpectContext(loc);
+  const res::Channel<T> ch                     = ctx_ptr->pub(loc).Init<T>(topic_name);
+  return {ch, ctx_ptr->pub(loc).Bind(ch)};
 }
 
 template <core::concepts::DirectlySupportedType T>
@@ -66,7 +68,9 @@ ctx::Publisher<T>& Publisher(ctx::Publisher<T>& res, const std::string_view& top
 template <class T, core::concepts::ByConverter TConverter>
 [[nodiscard]] ctx::Publisher<T> Publisher(const std::string_view& topic_name, AIMRTE(src(loc)))
 {
-  return {core::details::ExpectContext(loc)->pub(loc).Init<T, TConverter>(topic_name)};
+  const std::shared_ptr<core::Context> ctx_ptr = core::details::ExpectContext(loc);
+  const res::Channel<T> ch                     = ctx_ptr->pub(loc).Init<T, TConverter>(topic_name);
+  return {ch, ctx_ptr->pub(loc).Bind(ch)};
 }
 
 template <class T, core::concepts::ByConverter TConverter>
@@ -75,6 +79,18 @@ ctx::Publisher<T>& Publisher(ctx::Publisher<T>& res, const std::string_view& top
   return res = Publisher<T, TConverter>(topic_name, loc);
 }
 
+/**
+ * @brief 与上一个接口类似，但可指定发布信道的可选配置（如复用转换缓冲区）。
+ */
+template <class T, core::concepts::ByConverter TConverter>
+[[nodiscard]] ctx::Publisher<T> Publisher(
+  const std::string_view& topic_name, const core::PublishOption& option, AIMRTE(src(loc)))
+{
+  const std::shared_ptr<core::Context> ctx_ptr = core::details::ExpectContext(loc);
+  const res::Channel<T> ch                     = ctx_ptr->pub(loc).Init<T, TConverter>(topic_name, option);
+  return {ch, ctx_ptr->pub(loc).Bind(ch)};
+}
+
 /**
  * @brief 初始化指定通信类型与话题名称的订阅信道，并返回它的资源标识符。
  * @tparam T AimRT 支持的通信类型
@@ -93,6 +109,16 @@ ctx::Subscriber<T>& Subscriber(ctx::Subscriber<T>& res, const std::string_view&
   return res = Subscriber<T>(topic_name, loc);
 }
 
+/**
+ * @brief 与上一个接口类似，但可指定订阅队列的默认配置（队列深度与队列满时的策略）。
+ */
+template <core::concepts::DirectlySupportedType T>
+[[nodiscard]] ctx::Subscriber<T> Subscriber(
+  const std::string_view& topic_name, const core::QueueOption& queue, AIMRTE(src(loc)))
+{
+  return {core::details::ExpectContext(loc)->sub(loc).Init<T>(topic_name, queue)};
+}
+
 /**
  * @brief 在给定通信类型适配器的情况下，初始化指定用户类型与话题名称的订阅信道，
  *        并返回它的资源标识符。
@@ -113,6 +139,16 @@ ctx::Subscriber<T>& Subscriber(ctx::Subscriber<T>& res, const std::string_view&
   return res = Subscriber<T, TConverter>(topic_name, loc);
 }
 
+/**
+ * @brief 与上一个接口类似，但可指定订阅队列的默认配置（队列深度与队列满时的策略）。
+ */
+template <class T, core::concepts::ByConverter TConverter>
+[[nodiscard]] ctx::Subscriber<T> Subscriber(
+  const std::string_view& topic_name, const core::QueueOption& queue, AIMRTE(src(loc)))
+{
+  return {core::details::ExpectContext(loc)->sub(loc).Init<T, TConverter>(topic_name, queue)};
+}
+
 /**
  * @brief 初始化指定类型的服务调用资源
  * @tparam Q AimRT 支持的请求数据类型
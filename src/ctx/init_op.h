@@ -20,6 +20,15 @@ void SubscribeInline(const res::Channel<T>& ch, TCallback callback, AIMRTE(src(l
   core::details::ExpectContext(loc)->sub(loc).SubscribeInline(ch, std::move(callback));
 }
 
+/**
+ * @brief 与上一个接口类似，但可指定订阅的可选配置（如池化的消息分发）。
+ */
+template <class T, core::concepts::SupportedSubscriber<T> TCallback>
+void SubscribeInline(const res::Channel<T>& ch, TCallback callback, const core::SubscribeOption& option, AIMRTE(src(loc)))
+{
+  core::details::ExpectContext(loc)->sub(loc).SubscribeInline(ch, std::move(callback), option);
+}
+
 /**
  * @brief 注册指定服务资源的服务处理回调，该回调发生在原生通信系统的回调中。
  * @tparam Q 请求数据类型
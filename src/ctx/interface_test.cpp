@@ -529,6 +529,33 @@ TEST_F(InterfaceTest, Loop)
   GTEST_ASSERT_TRUE(ret);
 }
 
+TEST_F(InterfaceTest, LoopDeadline)
+{
+  ctrl.LetRun();
+
+  ctx::Loop loop(std::chrono::milliseconds(100), {.policy = ctx::LoopPolicy::Skip, .name = "test_loop"});
+
+  // 首次调用立即返回，第二次等待一个周期，之后超时 150ms ，错过两个截止时间
+  GTEST_ASSERT_TRUE(loop.Ok().Sync());
+  GTEST_ASSERT_TRUE(loop.Ok().Sync());
+  std::this_thread::sleep_for(std::chrono::milliseconds(250));
+  GTEST_ASSERT_TRUE(loop.Ok().Sync());
+
+  const ctx::LoopStats stats = loop.GetStats();
+  GTEST_ASSERT_EQ(stats.iterations, 2);
+  GTEST_ASSERT_EQ(stats.overruns, 1);
+  GTEST_ASSERT_EQ(stats.skipped, 2);
+  GTEST_ASSERT_LT(stats.max_latency, std::chrono::milliseconds(50));
+
+  std::uint64_t histogram_total = 0;
+  for (const std::uint64_t n : stats.latency_histogram)
+    histogram_total += n;
+  GTEST_ASSERT_EQ(histogram_total, stats.iterations);
+
+  const std::vector<ctx::NamedLoopStats> all = ctx::CollectLoopStats();
+  GTEST_ASSERT_TRUE(std::ranges::any_of(all, [](const ctx::NamedLoopStats& one) { return one.name == "test_loop"; }));
+}
+
 TEST_F(InterfaceTest, Fs)
 {
   const std::filesystem::path home = std::filesystem::path(std::source_location::current().file_name()).parent_path().string() + "/test";
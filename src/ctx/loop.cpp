@@ -2,18 +2,94 @@
 // All rights reserved.
 
 #include "./loop.h"
+#include <bit>
+#include <mutex>
 #include "src/panic/panic.h"
 #include "./anytime.h"
 
 namespace aimrte::ctx
 {
-Loop::Loop(const std::chrono::steady_clock::duration period)
-    : period_(period)
+namespace
 {
+struct LoopEntry {
+  std::string name;
+  std::weak_ptr<Loop::Counter> counter;
+};
+
+std::mutex g_loops_mutex;
+std::vector<LoopEntry> g_loops;
+
+void RegisterLoopCounter(std::string name, std::weak_ptr<Loop::Counter> counter)
+{
+  const std::lock_guard lock(g_loops_mutex);
+  g_loops.push_back({std::move(name), std::move(counter)});
 }
+}  // namespace
 
-Loop::Loop(const std::uint32_t hz)
-    : Loop(std::chrono::nanoseconds(1000'000'000ull / hz))
+std::vector<NamedLoopStats> CollectLoopStats()
+{
+  std::vector<NamedLoopStats> result;
+
+  const std::lock_guard lock(g_loops_mutex);
+  result.reserve(g_loops.size());
+
+  // 收集存活的计数器，并顺带清理已经释放的
+  std::erase_if(
+    g_loops,
+    [&](const LoopEntry& entry) {
+      const std::shared_ptr counter = entry.counter.lock();
+      if (counter == nullptr)
+        return true;
+
+      result.push_back({entry.name, counter->Snapshot()});
+      return false;
+    });
+
+  return result;
+}
+
+void Loop::Counter::Record(const std::chrono::nanoseconds latency)
+{
+  const std::int64_t ns = std::max<std::int64_t>(latency.count(), 0);
+  const std::uint64_t us = static_cast<std::uint64_t>(ns) / 1000;
+
+  // 按微秒数的二进制位数分桶
+  const std::size_t bucket = std::min<std::size_t>(std::bit_width(us), LoopStats::kLatencyBuckets - 1);
+
+  iterations.fetch_add(1, std::memory_order_relaxed);
+  total_latency.fetch_add(ns, std::memory_order_relaxed);
+  latency_histogram[bucket].fetch_add(1, std::memory_order_relaxed);
+
+  // 仅由循环所在的线程写入，无需比较交换
+  if (ns > max_latency.load(std::memory_order_relaxed))
+    max_latency.store(ns, std::memory_order_relaxed);
+}
+
+LoopStats Loop::Counter::Snapshot() const
+{
+  LoopStats stats{
+    .iterations    = iterations.load(std::memory_order_relaxed),
+    .overruns      = overruns.load(std::memory_order_relaxed),
+    .skipped       = skipped.load(std::memory_order_relaxed),
+    .max_latency   = std::chrono::nanoseconds(max_latency.load(std::memory_order_relaxed)),
+    .total_latency = std::chrono::nanoseconds(total_latency.load(std::memory_order_relaxed)),
+  };
+
+  for (std::size_t i = 0; i < LoopStats::kLatencyBuckets; ++i)
+    stats.latency_histogram[i] = latency_histogram[i].load(std::memory_order_relaxed);
+
+  return stats;
+}
+
+Loop::Loop(const std::chrono::steady_clock::duration period, LoopOption option)
+    : period_(period), option_(std::move(option))
+{
+  if (option_.policy != LoopPolicy::Relative)
+    counter_ = std::make_shared<Counter>();
+}
+
+Loop::Loop(const std::uint32_t hz, LoopOption option)
+    : Loop(std::chrono::nanoseconds(1000'000'000ull / hz), std::move(option))
 {
 }
 
@@ -23,6 +99,9 @@ co::Task<bool> Loop::Ok(const std::source_location loc)
   if (period_.count() == 0)
     co_return ctx::Ok(loc);
 
+  if (option_.policy != LoopPolicy::Relative)
+    co_return co_await OkUntilDeadline(loc);
+
   // 尽量减少系统调用。使用 += dt 的方式更新时间点，虽略有误差，但能减少开销；
   // 若 sleep 后被重新调度的时机很靠后， += dt 的时间点会比实际更早，但也说明 loop 已滞后，需要被快速再次调用
   const auto now_tp = std::chrono::steady_clock::now();
@@ -37,4 +116,49 @@ co::Task<bool> Loop::Ok(const std::source_location loc)
 
   co_return ctx::Ok(loc);
 }
+
+co::Task<bool> Loop::OkUntilDeadline(const std::source_location loc)
+{
+  const auto now_tp = std::chrono::steady_clock::now();
+
+  // 首次调用，记录起点并立即返回，同时登记到进程级的监控中
+  if (start_tp_ == std::chrono::steady_clock::time_point{}) {
+    start_tp_ = now_tp;
+    k_        = 0;
+
+    RegisterLoopCounter(
+      option_.name.empty() ? ::fmt::format("{}:{}", loc.file_name(), loc.line()) : option_.name,
+      counter_);
+
+    co_return ctx::Ok(loc);
+  }
+
+  auto deadline_tp = start_tp_ + period_ * ++k_;
+
+  if (now_tp >= deadline_tp) {
+    counter_->overruns.fetch_add(1, std::memory_order_relaxed);
+
+    // 追赶模式下立即返回，由后续的迭代逐步追上截止时间
+    if (option_.policy == LoopPolicy::CatchUp) {
+      counter_->Record(now_tp - deadline_tp);
+      co_return ctx::Ok(loc);
+    }
+
+    // 跳过模式下，对齐到下一个未来的截止时间点
+    const std::uint64_t next_k = static_cast<std::uint64_t>((now_tp - start_tp_) / period_) + 1;
+    counter_->skipped.fetch_add(next_k - k_, std::memory_order_relaxed);
+    k_          = next_k;
+    deadline_tp = start_tp_ + period_ * k_;
+  }
+
+  co_await ctx::Sleep(deadline_tp - std::chrono::steady_clock::now(), loc);
+  counter_->Record(std::chrono::steady_clock::now() - deadline_tp);
+
+  co_return ctx::Ok(loc);
+}
+
+LoopStats Loop::GetStats() const
+{
+  return counter_ != nullptr ? counter_->Snapshot() : LoopStats{};
+}
 }  // namespace aimrte::ctx
@@ -3,23 +3,128 @@
 
 #pragma once
 
+#include <array>
+#include <atomic>
 #include <chrono>
 #include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
 #include "./run.h"
 
 namespace aimrte::ctx
 {
+/**
+ * @brief 周期循环的调度策略
+ */
+enum class LoopPolicy {
+  // 以上一次唤醒的时间点为基准，睡眠剩余的周期，超时的迭代将被吸收（原有行为）
+  Relative,
+
+  // 以绝对的截止时间（start + k * period）调度，超时后立即连续执行，直到追上进度
+  CatchUp,
+
+  // 以绝对的截止时间调度，超时后跳过已经错过的周期，在下一个未来的截止时间点唤醒
+  Skip,
+};
+
+/**
+ * @brief 周期循环的选项
+ */
+struct LoopOption {
+  LoopPolicy policy = LoopPolicy::Relative;
+
+  // 循环的名称，用于进程级的监控。为空时，使用首次调用 Ok() 处的源码位置。
+  std::string name;
+};
+
+/**
+ * @brief 周期循环的统计数据快照，仅在截止时间模式（CatchUp、Skip）下被记录。
+ */
+struct LoopStats {
+  // 唤醒延迟直方图的桶数量：第 0 个桶为 [0, 1us) ，第 i 个桶为 [2^(i-1), 2^i) us ，最后一个桶不设上限
+  static constexpr std::size_t kLatencyBuckets = 18;
+
+  // 已经完成的迭代次数
+  std::uint64_t iterations = 0;
+
+  // 在截止时间之后才调用 Ok() 的次数
+  std::uint64_t overruns = 0;
+
+  // 因超时而跳过的周期数量（仅 LoopPolicy::Skip 策略）
+  std::uint64_t skipped = 0;
+
+  // 唤醒延迟（实际返回时间与截止时间之差）的最大值与总和
+  std::chrono::nanoseconds max_latency{};
+  std::chrono::nanoseconds total_latency{};
+
+  // 唤醒延迟直方图
+  std::array<std::uint64_t, kLatencyBuckets> latency_histogram{};
+
+  /**
+   * @return 平均唤醒延迟
+   */
+  [[nodiscard]] std::chrono::nanoseconds MeanLatency() const
+  {
+    return iterations == 0 ? std::chrono::nanoseconds{} : total_latency / static_cast<std::int64_t>(iterations);
+  }
+};
+
+/**
+ * @brief 带有名称的周期循环统计数据，用于进程级的监控。
+ */
+struct NamedLoopStats {
+  std::string name;
+  LoopStats stats;
+};
+
+/**
+ * @return 本进程内所有仍然存活的、截止时间模式的周期循环的统计数据
+ */
+std::vector<NamedLoopStats> CollectLoopStats();
+
 class Loop
 {
  public:
   Loop() = default;
-  explicit Loop(std::chrono::steady_clock::duration period);
-  explicit Loop(std::uint32_t hz);
+  explicit Loop(std::chrono::steady_clock::duration period, LoopOption option = {});
+  explicit Loop(std::uint32_t hz, LoopOption option = {});
 
   co::Task<bool> Ok(AIMRTE(src(loc)));
 
+  /**
+   * @return 本循环的统计数据，仅在截止时间模式下有效
+   */
+  [[nodiscard]] LoopStats GetStats() const;
+
+ public:
+  // 周期循环的统计计数器，由循环所在的线程更新，可被监控并发读取
+  struct Counter {
+    std::atomic_uint64_t iterations    = 0;
+    std::atomic_uint64_t overruns      = 0;
+    std::atomic_uint64_t skipped       = 0;
+    std::atomic_int64_t max_latency    = 0;
+    std::atomic_int64_t total_latency  = 0;
+    std::array<std::atomic_uint64_t, LoopStats::kLatencyBuckets> latency_histogram{};
+
+    void Record(std::chrono::nanoseconds latency);
+
+    [[nodiscard]] LoopStats Snapshot() const;
+  };
+
+ private:
+  co::Task<bool> OkUntilDeadline(std::source_location loc);
+
  private:
   std::chrono::steady_clock::duration period_{};
   std::chrono::steady_clock::time_point tp_{};
+
+  LoopOption option_;
+
+  // 截止时间模式下，第 0 个周期的起点，与已经经过的周期数量
+  std::chrono::steady_clock::time_point start_tp_{};
+  std::uint64_t k_ = 0;
+
+  std::shared_ptr<Counter> counter_;
 };
 }  // namespace aimrte::ctx
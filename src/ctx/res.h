@@ -27,7 +27,18 @@ class Executor : public res::Executor
     template <class T, core::concepts::SupportedSubscriber<T> TCallback>
     const WhenInitOperator& Subscribe(const res::Channel<T>& ch, TCallback callback, AIMRTE(src(loc))) const
     {
-      ctx::init::exe(this_).Subscribe(ch, std::move(callback), loc);
+      ctx::init::exe(this_, loc).Subscribe(ch, std::move(callback));
+      return *this;
+    }
+
+    /**
+     * @brief 与上一个接口类似，但可指定订阅的可选配置（如池化的消息分发）。
+     */
+    template <class T, core::concepts::SupportedSubscriber<T> TCallback>
+    const WhenInitOperator& Subscribe(
+      const res::Channel<T>& ch, TCallback callback, const core::SubscribeOption& option, AIMRTE(src(loc))) const
+    {
+      ctx::init::exe(this_, loc).Subscribe(ch, std::move(callback), option);
       return *this;
     }
 
@@ -76,6 +87,16 @@ class Executor : public res::Executor
     return *this;
   }
 
+  /**
+   * @brief 在本执行器中，以给定的优先级执行给定函数或协程，仅对支持优先级的执行器生效
+   */
+  template <core::concepts::SupportedInvoker F>
+  const Executor& Post(core::Priority prio, F f, AIMRTE(src(loc))) const
+  {
+    ctx::exe(*this, loc).Post(prio, std::move(f));
+    return *this;
+  }
+
   /**
    * @brief 在本执行器中，执行给定函数或协程
    * @param scope 协程的生命周期将由该 scope 管理
@@ -142,12 +163,41 @@ class Publisher : public res::Channel<T>
  public:
   /**
    * @brief 基于当前的上下文信息，通过本发布器资源通道发布数据。
+   *        若本发布器在初始化时绑定了发布句柄，将直接通过句柄发布。
    */
   void Publish(const T& msg, AIMRTE(src(loc))) const
   {
+    if (handle_.IsValid()) [[likely]] {
+      handle_.Publish(msg);
+      return;
+    }
+
     ctx::Publish(*this, msg, loc);
   }
 
+  /**
+   * @brief 通过本发布器资源通道，发布可被移走的数据。
+   *        对于带有转换器的信道，将通过 impl::ConvertMoved 转换，避免深拷贝。
+   */
+  void Publish(T&& msg, AIMRTE(src(loc))) const
+  {
+    if (handle_.IsValid()) [[likely]] {
+      handle_.Publish(std::move(msg));
+      return;
+    }
+
+    ctx::Publish(*this, std::move(msg), loc);
+  }
+
+  /**
+   * @brief 通过本发布器资源通道，发布共享的数据。对于启用了进程内通信的话题，
+   *        订阅者将直接共享该对象，不经过序列化与拷贝；其余情况与常引用版本相同。
+   */
+  void PublishShared(std::shared_ptr<const T> msg, AIMRTE(src(loc))) const
+  {
+    ctx::PublishShared(*this, std::move(msg), loc);
+  }
+
   const Publisher& operator<<(const T& msg) const
   {
     Publish(msg);
@@ -164,6 +214,11 @@ class Publisher : public res::Channel<T>
     Publish(msg, loc);
   }
 
+  void operator()(T&& msg, AIMRTE(src(loc))) const
+  {
+    Publish(std::move(msg), loc);
+  }
+
  public:
   Publisher() = default;
   using res::Channel<T>::Channel;
@@ -177,6 +232,15 @@ class Publisher : public res::Channel<T>
       : res::Channel<T>(res)
   {
   }
+
+  Publisher(const res::Channel<T>& res, core::Context::PublishHandle<T> handle)
+      : res::Channel<T>(res), handle_(std::move(handle))
+  {
+  }
+
+ private:
+  // 初始化时绑定的发布句柄，仅由 init::Publisher 设置，无效时退回上下文查找的发布过程
+  core::Context::PublishHandle<T> handle_;
 };
 
 /**
@@ -198,6 +262,15 @@ class Subscriber : public res::Channel<T>
       ctx::init::SubscribeInline(this_, std::move(callback), loc);
     }
 
+    /**
+     * @brief 与上一个接口类似，但可指定订阅的可选配置（如池化的消息分发）。
+     */
+    template <core::concepts::SupportedSubscriber<T> TCallback>
+    void SubscribeInline(TCallback callback, const core::SubscribeOption& option, AIMRTE(src(loc))) const
+    {
+      ctx::init::SubscribeInline(this_, std::move(callback), option, loc);
+    }
+
     /**
      * @brief 在指定执行器上，注册本信道资源的消息回调。
      * @param callback 回调函数或协程，参数为 std::shared_ptr<T> 或 const T&
@@ -209,6 +282,16 @@ class Subscriber : public res::Channel<T>
       ctx::init::exe(exe, loc).Subscribe(this_, std::move(callback));
     }
 
+    /**
+     * @brief 与上一个接口类似，但可指定订阅的可选配置（如池化的消息分发）。
+     */
+    template <core::concepts::SupportedSubscriber<T> TCallback>
+    void SubscribeOn(
+      const res::Executor& exe, TCallback callback, const core::SubscribeOption& option, AIMRTE(src(loc))) const
+    {
+      ctx::init::exe(exe, loc).Subscribe(this_, std::move(callback), option);
+    }
+
    private:
     friend class Subscriber;
 
@@ -242,6 +325,14 @@ class Subscriber : public res::Channel<T>
       : res::Channel<T>(res)
   {
   }
+
+  /**
+   * @return 本订阅的统计数据（收到的、被丢弃的消息数量，以及有界队列的长度）
+   */
+  [[nodiscard]] core::SubscribeStats GetStats(AIMRTE(src(loc))) const
+  {
+    return core::details::ExpectContext(loc)->sub(loc).GetStats(*this);
+  }
 };
 
 /**
@@ -17,17 +17,35 @@ details::RunningExecutorRef exe(const res::Executor& exe, const std::source_loca
 
 co::Task<void> Sleep(const std::chrono::steady_clock::duration& duration, const std::source_location loc)
 {
-  if (const res::Executor& exe = core::details::g_thread_ctx.exe; exe.IsValid())
-    co_await aimrt::co::ScheduleAfter(core::details::GetScheduler(exe, loc), duration);
-  else
+  if (const res::Executor& exe = core::details::g_thread_ctx->exe; not exe.IsValid())
     std::this_thread::sleep_for(duration);
+  else if (core::details::TimerWheel* wheel = core::details::GetTimerWheel(exe, loc); wheel != nullptr)
+    co_await wheel->Sleep(duration);
+  else
+    co_await aimrt::co::ScheduleAfter(core::details::GetScheduler(exe, loc), duration);
 }
 
 co::Task<void> Yield(const std::source_location loc)
 {
-  if (const res::Executor& exe = core::details::g_thread_ctx.exe; not co::synchronized and exe.IsValid())
-    co_await aimrt::co::Schedule(core::details::GetScheduler(exe, loc));
+  const res::Executor& exe = core::details::g_thread_ctx->exe;
+
+  // 同步等待的线程若正是执行器的线程，重新投递将导致死锁，只能在原地让出
+  if (exe.IsValid()) {
+    if (not co::synchronized or not core::details::IsInExecutor(exe, loc)) {
+      co_await aimrt::co::Schedule(core::details::GetScheduler(exe, loc));
+      co_return;
+    }
+  }
+
+  // FIXME: 同步等待的线程正是执行器的线程时，排在该线程上的其他协程（如持有 SpinMutex 的协程）在本协程结束前无法被调度，
+  //        退避仅能限制 CPU 的占用，无法消除这种饥饿。彻底解决需要 Task::Sync 在等待时自行驱动该执行器的任务队列。
+  // 在原地让出：起初仅让出时间片，之后以指数退避的时长休眠，上限为 1ms
+  constexpr std::uint32_t kPureYields = 16;
+  constexpr std::uint32_t kMaxShift   = 10;
+
+  if (const std::uint32_t n = co::synchronized_yields++; n < kPureYields)
+    std::this_thread::yield();
   else
-    std::this_thread::yield();  // FIXME ，如果在一个 exe 上，且该 exe sync await，如果执行 this_thread::yield() 会导致其他协程不会进来调度。导致一个协程一直 yield，会拉高 CPU
+    std::this_thread::sleep_for(std::chrono::microseconds(1u << std::min(n - kPureYields, kMaxShift)));
 }
 }  // namespace aimrte::ctx
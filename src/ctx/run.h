@@ -13,13 +13,8 @@ namespace aimrte::ctx::details
 class RunningExecutorRef
 {
  public:
-  RunningExecutorRef(const res::Executor& exe, const std::source_location call_loc)
-      : exe_(exe), call_loc_(call_loc)
-  {
-  }
-
-  RunningExecutorRef(res::Executor&& exe, const std::source_location call_loc)
-      : temp_exe_(std::move(exe)), exe_(temp_exe_), call_loc_(call_loc)
+  RunningExecutorRef(res::Executor exe, const std::source_location call_loc)
+      : exe_(std::move(exe)), call_loc_(call_loc)
   {
   }
 
@@ -34,6 +29,18 @@ class RunningExecutorRef
     return *this;
   }
 
+  /**
+   * @brief 使用当前上下文中、已有的执行器信息，以给定的优先级执行给定函数（线程）或协程，
+   *        仅对支持优先级的执行器生效。
+   */
+  template <class F>
+    requires core::concepts::SupportedInvoker<F>
+  RunningExecutorRef& Post(core::Priority prio, F f)
+  {
+    core::details::ExpectContext(call_loc_)->exe(exe_, call_loc_).Post(prio, std::move(f));
+    return *this;
+  }
+
   /**
    * @brief 使用当前上下文中、已有的执行器信息，执行给定函数（线程）或协程，
    *        但使用用户提供的异步管理器对该任务进行生命周期管理。
@@ -59,8 +66,8 @@ class RunningExecutorRef
   }
 
  private:
-  const res::Executor temp_exe_;
-  const res::Executor& exe_;
+  // 持有执行器资源的副本：默认参数引用的是当前线程上下文中的数据，投递任务时该上下文可能被替换并释放
+  const res::Executor exe_;
   const std::source_location call_loc_;
 };
 }  // namespace aimrte::ctx::details
@@ -81,7 +88,7 @@ namespace aimrte::ctx
  * @param loc 仅用于记录调用处的信息
  */
 [[nodiscard]] details::RunningExecutorRef exe(
-  const res::Executor& exe = core::details::g_thread_ctx.exe, AIMRTE(src(loc)));
+  const res::Executor& exe = core::details::g_thread_ctx->exe, AIMRTE(src(loc)));
 
 /**
  * @brief 基于当前的上下文信息，发布指定资源的数据。
@@ -92,6 +99,26 @@ void Publish(const res::Channel<T>& res, const T& msg, AIMRTE(src(loc)))
   core::details::ExpectContext(loc)->pub(loc).Publish(res, msg);
 }
 
+/**
+ * @brief 基于当前的上下文信息，发布指定资源的可被移走的数据。
+ *        对于带有转换器的信道，将通过 impl::ConvertMoved 转换，避免深拷贝。
+ */
+template <class T>
+void Publish(const res::Channel<T>& res, T&& msg, AIMRTE(src(loc)))
+{
+  core::details::ExpectContext(loc)->pub(loc).Publish(res, std::move(msg));
+}
+
+/**
+ * @brief 基于当前的上下文信息，发布指定资源的共享数据。
+ *        对于启用了进程内通信的话题，订阅者将直接共享该对象，不经过序列化与拷贝。
+ */
+template <class T>
+void PublishShared(const res::Channel<T>& res, std::shared_ptr<const T> msg, AIMRTE(src(loc)))
+{
+  core::details::ExpectContext(loc)->pub(loc).PublishShared(res, std::move(msg));
+}
+
 /**
  * @brief 使用指定服务资源，发起远程调用。
  * @tparam Q 请求数据类型
@@ -138,7 +165,12 @@ template <core::concepts::DirectlySupportedType Q, core::concepts::DirectlySuppo
 [[nodiscard]] co::Task<void> Sleep(const std::chrono::steady_clock::duration& duration, AIMRTE(src(loc)));
 
 /**
- * @brief 让出本协程的执行
+ * @brief 让出本协程的执行。
+ *
+ * 在执行器上时，本协程被重新投递到执行器的队列末尾。若本协程被同步等待（Sync），且同步等待的线程
+ * 不属于该执行器，同样重新投递到执行器，同步等待的线程将在其事件循环中休眠，直到协程完成；
+ * 否则（不在执行器上，或同步等待的线程就是执行器的线程），在原地让出线程，并随让出次数逐步退避到短暂休眠，
+ * 避免基于本接口的自旋等待占满 CPU 。
  */
 [[nodiscard]] co::Task<void> Yield(AIMRTE(src(loc)));
 }  // namespace aimrte::ctx
@@ -414,4 +414,22 @@ Cfg& Cfg::SetCoreLogLevel(const cfg::LogLevel level)
   aimrt_config_.log.core_lvl = level;
   return *this;
 }
+
+Cfg& Cfg::SetIntraProcessTopic(std::string topic_name)
+{
+  intra_process_topics_.insert(std::move(topic_name));
+  return *this;
+}
+
+Cfg& Cfg::SetTimerWheel(std::string executor_name, const std::chrono::nanoseconds tick)
+{
+  timer_wheels_.insert_or_assign(std::move(executor_name), tick);
+  return *this;
+}
+
+Cfg& Cfg::SetExecutorStats(std::string executor_name)
+{
+  stats_executors_.insert(std::move(executor_name));
+  return *this;
+}
 }  // namespace aimrte
@@ -6,6 +6,9 @@
 #include <fmt/format.h>
 #include <yaml-cpp/yaml.h>
 #include <rfl/yaml.hpp>
+#include <chrono>
+#include <map>
+#include <set>
 #include <string>
 #include "src/ctx/ctx.h"
 #include "src/macro/macro.h"
@@ -24,7 +27,7 @@
 #define AIMRTE_DETAILS_CFG_PLUGIN_INVOKE(_func_) AIMRTE_INVOKE_INDEX(_func_, ros2, mqtt, net, parameter, log_control, opentelemetry, monitor, zenoh, iceoryx, record_playback, omp, echo, proxy, topic_logger, viz)
 #define AIMRTE_DETAILS_CFG_CHANNEL_INVOKE(_func_) AIMRTE_INVOKE_INDEX(_func_, ros2, mqtt, http, tcp, udp, local, monitor, zenoh, iceoryx)
 #define AIMRTE_DETAILS_CFG_RPC_INVOKE(_func_) AIMRTE_INVOKE_INDEX(_func_, ros2, mqtt, http, local, monitor, omp, zenoh)
-#define AIMRTE_DETAILS_CFG_EXE_INVOKE(_func_) AIMRTE_INVOKE_INDEX(_func_, simple_thread, asio_thread, asio_strand, tbb_thread, time_wheel)
+#define AIMRTE_DETAILS_CFG_EXE_INVOKE(_func_) AIMRTE_INVOKE_INDEX(_func_, simple_thread, asio_thread, asio_strand, tbb_thread, time_wheel, work_stealing, priority_thread)
 
 /// 定义 cfg 的各种枚举量
 namespace aimrte::cfg
@@ -441,6 +444,26 @@ class Cfg
    */
   Cfg& SetCoreLogLevel(cfg::LogLevel level);
 
+  /**
+   * @brief 为指定话题启用进程内通信：该话题的发布与订阅不再经过通信后端，订阅者直接共享发布的对象。
+   *        也可以在外部配置文件的 aimrte.channel.intra_process_topics 列表中给定。
+   * @note  仅适用于发布者与所有订阅者都在本进程内的话题，且它们须使用同一种用户类型。
+   */
+  Cfg& SetIntraProcessTopic(std::string topic_name);
+
+  /**
+   * @brief 为指定执行器启用时间轮：该执行器上的睡眠协程由时间轮按给定精度批量唤醒，适用于大量协程周期性睡眠的执行器。
+   *        也可以在外部配置文件的 aimrte.executor.timer_wheels 列表中给定（name 与 tick_us）。
+   * @note  执行器须支持定时调度，如 asio_thread 。
+   */
+  Cfg& SetTimerWheel(std::string executor_name, std::chrono::nanoseconds tick);
+
+  /**
+   * @brief 为指定执行器启用任务统计：投递任务的数量、排队深度、排队等待时间与运行时间，由监控插件定期上报。
+   *        也可以在外部配置文件的 aimrte.executor.stats 列表中给定执行器名称。
+   */
+  Cfg& SetExecutorStats(std::string executor_name);
+
   /**
    * @brief 获取当前进程在deployment.yaml中的配置信息
    * @return 当前进程在deployment.yaml中的配置节点
@@ -717,5 +740,14 @@ class Cfg
 
   // 模块的配置，需要通过 SetConfig() 进行设置
   YAML::Node modules_config_;
+
+  // 启用了进程内通信的话题
+  std::set<std::string> intra_process_topics_;
+
+  // 启用了时间轮的执行器，及其精度
+  std::map<std::string, std::chrono::nanoseconds> timer_wheels_;
+
+  // 启用了任务统计的执行器
+  std::set<std::string> stats_executors_;
 };
 }  // namespace aimrte
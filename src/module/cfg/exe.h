@@ -89,6 +89,34 @@ struct tbb_thread {
   std::optional<Option> options;
 };
 
+/**
+ * @brief work_stealing 执行器配置，由 aimrte 提供：每个工作线程拥有独立的任务队列，空闲时从其他线程窃取任务，
+ *        适用于大量细粒度协程的扇出场景。
+ */
+struct work_stealing {
+  struct Option {
+    std::optional<std::uint32_t> thread_num;
+    std::optional<std::string> thread_sched_policy;
+    std::optional<std::vector<std::uint32_t>> thread_bind_cpu;
+  };
+
+  std::string type{"work_stealing"};
+  std::string name;
+  std::optional<Option> options;
+};
+
+/**
+ * @brief priority_thread 执行器配置，由 aimrte 提供：按任务投递时的优先级（core::Priority）分队列调度，
+ *        高优先级的任务总是先于已排队的低优先级任务执行。
+ */
+struct priority_thread {
+  using Option = work_stealing::Option;
+
+  std::string type{"priority_thread"};
+  std::string name;
+  std::optional<Option> options;
+};
+
 /**
  * @brief time_wheel 执行器配置
  */
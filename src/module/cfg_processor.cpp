@@ -120,6 +120,42 @@ void Cfg::Processor::AddDefaultLocal()
   cfg_.WithDefaultLocal();
 }
 
+void Cfg::Processor::EnableIntraProcessTopics(const YAML::Node& ext)
+{
+  // 合并外部配置中给定的话题
+  if (not cfg::details::IsUndefined(ext) and not cfg::details::IsUndefined(ext["channel"])) {
+    for (const YAML::Node& i : ext["channel"]["intra_process_topics"])
+      cfg_.intra_process_topics_.insert(i.as<std::string>());
+  }
+
+  for (const std::string& i : cfg_.intra_process_topics_)
+    core::EnableIntraProcessTopic(i);
+}
+
+void Cfg::Processor::EnableTimerWheels(const YAML::Node& ext)
+{
+  // 合并外部配置中给定的执行器
+  if (not cfg::details::IsUndefined(ext) and not cfg::details::IsUndefined(ext["executor"])) {
+    for (const YAML::Node& i : ext["executor"]["timer_wheels"])
+      cfg_.timer_wheels_.insert_or_assign(i["name"].as<std::string>(), std::chrono::microseconds(i["tick_us"].as<std::uint64_t>()));
+  }
+
+  for (const auto& [name, tick] : cfg_.timer_wheels_)
+    core::EnableTimerWheel(name, tick);
+}
+
+void Cfg::Processor::EnableExecutorStats(const YAML::Node& ext)
+{
+  // 合并外部配置中给定的执行器
+  if (not cfg::details::IsUndefined(ext) and not cfg::details::IsUndefined(ext["executor"])) {
+    for (const YAML::Node& i : ext["executor"]["stats"])
+      cfg_.stats_executors_.insert(i.as<std::string>());
+  }
+
+  for (const std::string& i : cfg_.stats_executors_)
+    core::EnableExecutorStats(i);
+}
+
 void Cfg::Processor::AddHDSCfg()
 {
   const auto HDS_TOPIC = "/aima/hds/exception";
@@ -555,6 +591,15 @@ std::string Cfg::Processor::DumpFile()
     PatchAimRTNode(yaml["aimrt"], patch["aimrte"]);
   }
 
+  // 启用进程内通信的话题
+  EnableIntraProcessTopics(ext_yaml["aimrte"]);
+
+  // 启用时间轮的执行器
+  EnableTimerWheels(ext_yaml["aimrte"]);
+
+  // 启用任务统计的执行器
+  EnableExecutorStats(ext_yaml["aimrte"]);
+
   // 合并模块配置
   MergeCustomNodes(yaml, ext_yaml);
 
@@ -38,6 +38,21 @@ class Cfg::Processor
 
   void AddDefaultLocal();
 
+  /**
+   * @brief 合并外部配置中的进程内通信话题，并为所有这些话题启用进程内通信
+   */
+  void EnableIntraProcessTopics(const YAML::Node& ext);
+
+  /**
+   * @brief 合并外部配置中的时间轮设置，并为所有这些执行器启用时间轮
+   */
+  void EnableTimerWheels(const YAML::Node& ext);
+
+  /**
+   * @brief 合并外部配置中的执行器统计设置，并为所有这些执行器启用任务统计
+   */
+  void EnableExecutorStats(const YAML::Node& ext);
+
   /**
    * @brief 注入框架的默认配置
    */
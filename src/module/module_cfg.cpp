@@ -175,6 +175,12 @@ ChPart& ChPart::DefSub(std::string name)
   return *this;
 }
 
+ChPart& ChPart::Queue(const core::QueueOption queue)
+{
+  queue_ = queue;
+  return *this;
+}
+
 RpcPart::RpcPart(ModuleCfg* cfg, const cfg::Rpc methods)
     : Session(cfg), methods_(methods)
 {
@@ -255,6 +255,12 @@ class ChPart : public Session
    */
   ChPart& DefSub(std::string name);
 
+  /**
+   * @brief 设置随后定义的 topic 订阅端的默认队列配置（队列深度与队列满时的策略），
+   *        仅对注册在执行器上的订阅回调生效。
+   */
+  ChPart& Queue(core::QueueOption queue);
+
   /**
    * @brief 定义一个 topic 发布端。
    * @tparam T 用于通信的数据类型，可自动推导。
@@ -335,6 +341,7 @@ class ChPart : public Session
 
  private:
   cfg::Ch methods_{cfg::Ch::Default};
+  core::QueueOption queue_;
 };
 
 /**
@@ -661,8 +668,8 @@ ChPart& ChPart::Def(ctx::Subscriber<T>& res, std::string name)
     DefSub(res.GetName());
 
     cfg_->resource_manager_->AddInitializer(
-      [&res, name{res.GetName()}]() {
-        res = init::Subscriber<T>(name);
+      [&res, name{res.GetName()}, queue{queue_}]() {
+        res = init::Subscriber<T>(name, queue);
       });
   } else {
     DefBy<typename convert::For<T>::AnotherType>(res, std::move(name));
@@ -692,8 +699,8 @@ ChPart& ChPart::DefBy(ctx::Subscriber<T>& res, std::string name)
   DefSub(res.GetName());
 
   cfg_->resource_manager_->AddInitializer(
-    [&res, name{res.GetName()}]() {
-      res = init::Subscriber<T, convert::By<TRaw>>(name);
+    [&res, name{res.GetName()}, queue{queue_}]() {
+      res = init::Subscriber<T, convert::By<TRaw>>(name, queue);
     });
 
   return *this;
@@ -3,7 +3,13 @@
 
 #pragma once
 
+#include <cstdint>
+#include <functional>
+#include <mutex>
 #include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_set>
 
 namespace aimrte::core
 {
@@ -12,6 +18,72 @@ class Context;
 
 namespace aimrte::res::details
 {
+/**
+ * @brief 驻留的资源名称，只记录指向全局名称表中字符串的指针。
+ *
+ * 同一名称在进程中只存储一份，且永不释放，故本类型可以平凡地复制，
+ * 资源标识符在回调、协程之间传递时，不再复制字符串。名称仅在日志等场合被读取。
+ */
+class Name
+{
+ public:
+  Name() noexcept = default;
+
+  Name(const std::string_view name)
+      : str_(Intern(name))
+  {
+  }
+
+  Name(const std::string& name)
+      : Name(std::string_view(name))
+  {
+  }
+
+  Name(const char* name)
+      : Name(std::string_view(name))
+  {
+  }
+
+  [[nodiscard]] const std::string& Get() const noexcept
+  {
+    return *str_;
+  }
+
+ private:
+  static const std::string* Intern(const std::string_view name)
+  {
+    struct Hash {
+      using is_transparent = void;
+
+      std::size_t operator()(const std::string_view str) const noexcept
+      {
+        return std::hash<std::string_view>{}(str);
+      }
+    };
+
+    // 有意泄漏，使静态析构阶段仍存活的资源（如其他全局对象持有的资源）的名称保持有效
+    static std::mutex mutex;
+    static auto* names = new std::unordered_set<std::string, Hash, std::equal_to<>>();
+
+    if (name.empty())
+      return &kEmpty;
+
+    const std::lock_guard lock(mutex);
+
+    auto it = names->find(name);
+    if (it == names->end())
+      it = names->emplace(name).first;
+
+    // 无序集合的元素地址在插入其他元素后保持不变
+    return &*it;
+  }
+
+ private:
+  static inline const std::string kEmpty{};
+
+  const std::string* str_ = &kEmpty;
+};
+
 /**
  * @brief 资源标识的基类，记录了所有资源都有的名称与索引。
  */
@@ -20,8 +92,8 @@ class Base
  public:
   Base() = default;
 
-  explicit Base(std::string name)
-      : name_(std::move(name))
+  explicit Base(const std::string_view name)
+      : name_(name)
   {
   }
 
@@ -33,7 +105,7 @@ class Base
 
   [[nodiscard]] const std::string& GetName() const
   {
-    return name_;
+    return name_.Get();
   }
 
  private:
@@ -41,7 +113,7 @@ class Base
 
  private:
   // 资源名称
-  std::string name_;
+  Name name_;
 
   // 由 core::Context 管理的资源索引，用于加速访问
   std::size_t idx_ = -1;
@@ -50,9 +122,11 @@ class Base
   int context_id_ = -1;
 
  public:
-  static void SetName(Base& obj, std::string name)
+  static void SetName(Base& obj, const std::string_view name)
   {
-    obj.name_ = std::move(name);
+    obj.name_ = name;
   }
 };
+
+static_assert(std::is_trivially_copyable_v<Base>, "resource descriptors must stay cheap to copy");
 }  // namespace aimrte::res::details
@@ -0,0 +1,173 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./priority_executor.h"
+#include <algorithm>
+#include <fmt/format.h>
+#include "src/runtime/core/util/thread_tools.h"
+
+namespace aimrte::runtime::executor
+{
+namespace
+{
+// 当前线程所属的执行器
+thread_local const PriorityExecutor* t_executor = nullptr;
+
+// 当前线程上正在执行的任务的优先级
+thread_local core::Priority t_priority = core::Priority::Normal;
+}  // namespace
+
+void PriorityExecutor::Register(aimrt::runtime::core::executor::ExecutorManager& manager)
+{
+  manager.RegisterExecutorGenFunc(
+    kType, []() -> std::unique_ptr<aimrt::runtime::core::executor::ExecutorBase> {
+      return std::make_unique<PriorityExecutor>();
+    });
+}
+
+PriorityExecutor::~PriorityExecutor()
+{
+  Shutdown();
+}
+
+void PriorityExecutor::Initialize(const std::string_view name, YAML::Node options_node)
+{
+  name_ = name;
+
+  if (options_node and not options_node.IsNull()) {
+    if (options_node["thread_num"])
+      options_.thread_num = std::max(options_node["thread_num"].as<std::uint32_t>(), 1u);
+
+    if (options_node["thread_sched_policy"])
+      options_.thread_sched_policy = options_node["thread_sched_policy"].as<std::string>();
+
+    if (options_node["thread_bind_cpu"])
+      options_.thread_bind_cpu = options_node["thread_bind_cpu"].as<std::vector<std::uint32_t>>();
+  }
+}
+
+void PriorityExecutor::Start()
+{
+  {
+    const std::lock_guard lock(mutex_);
+    if (std::exchange(running_, true))
+      return;
+  }
+
+  threads_.reserve(options_.thread_num);
+  for (std::size_t i = 0; i < options_.thread_num; ++i)
+    threads_.emplace_back([this, i]() { WorkerLoop(i); });
+
+  // 定时任务在设定时已包装为带优先级的投递，定时线程直接调用即可
+  timer_thread_.Start(fmt::format("{}.timer", name_), [](aimrt::executor::Task&& task) { task(); });
+}
+
+void PriorityExecutor::Shutdown()
+{
+  {
+    const std::lock_guard lock(mutex_);
+    if (not std::exchange(running_, false))
+      return;
+
+    cv_.notify_all();
+  }
+
+  timer_thread_.Stop();
+
+  for (std::thread& thread : threads_)
+    thread.join();
+
+  threads_.clear();
+}
+
+bool PriorityExecutor::IsInCurrentExecutor() const noexcept
+{
+  return t_executor == this;
+}
+
+void PriorityExecutor::Execute(aimrt::executor::Task&& task) noexcept
+{
+  Push(PriorityOfPost(), std::move(task));
+}
+
+std::chrono::system_clock::time_point PriorityExecutor::Now() const noexcept
+{
+  return std::chrono::system_clock::now();
+}
+
+void PriorityExecutor::ExecuteAt(const std::chrono::system_clock::time_point tp, aimrt::executor::Task&& task) noexcept
+{
+  timer_thread_.Add(
+    tp, [this, prio = PriorityOfPost(), task = std::move(task)]() mutable {
+      Push(prio, std::move(task));
+    });
+}
+
+size_t PriorityExecutor::CurrentTaskNum() noexcept
+{
+  return pending_.load(std::memory_order_relaxed);
+}
+
+core::Priority PriorityExecutor::PriorityOfPost() const
+{
+  // 经由 OpExe::Post 投递时，使用其显式给出的优先级，并随即清除
+  if (const std::optional<core::Priority> prio = std::exchange(core::details::g_post_priority, std::nullopt); prio.has_value())
+    return *prio;
+
+  // 其他的投递（如协程在本执行器上恢复）沿用本执行器上当前任务的优先级，来自其他线程的使用默认优先级
+  return t_executor == this ? t_priority : core::Priority::Normal;
+}
+
+void PriorityExecutor::Push(const core::Priority prio, aimrt::executor::Task&& task)
+{
+  pending_.fetch_add(1, std::memory_order_relaxed);
+
+  {
+    const std::lock_guard lock(mutex_);
+    lanes_[static_cast<std::size_t>(prio)].push_back(std::move(task));
+  }
+
+  cv_.notify_one();
+}
+
+void PriorityExecutor::WorkerLoop(const std::size_t idx)
+{
+  t_executor = this;
+
+  aimrt::runtime::core::util::SetNameForCurrentThread(fmt::format("{}.{}", name_, idx));
+  aimrt::runtime::core::util::BindCpuForCurrentThread(options_.thread_bind_cpu);
+  aimrt::runtime::core::util::SetCpuSchedForCurrentThread(options_.thread_sched_policy);
+
+  std::unique_lock lock(mutex_);
+
+  while (true) {
+    // 从最高优先级开始，找到第一个非空的队列
+    auto lane = std::find_if(lanes_.rbegin(), lanes_.rend(), [](const auto& q) { return not q.empty(); });
+
+    if (lane == lanes_.rend()) {
+      // 退出时，仍需处理完队列中的任务
+      if (not running_)
+        break;
+
+      cv_.wait(lock);
+      continue;
+    }
+
+    aimrt::executor::Task task = std::move(lane->front());
+    lane->pop_front();
+
+    const auto prio = static_cast<core::Priority>(std::distance(lane, lanes_.rend()) - 1);
+
+    lock.unlock();
+
+    t_priority = prio;
+    task();
+    t_priority = core::Priority::Normal;
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+
+    lock.lock();
+  }
+
+  t_executor = nullptr;
+}
+}  // namespace aimrte::runtime::executor
@@ -0,0 +1,100 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "src/core/priority.h"
+#include "src/runtime/core/executor/executor_base.h"
+#include "src/runtime/core/executor/executor_manager.h"
+#include "./timer_thread.h"
+
+namespace aimrte::runtime::executor
+{
+/**
+ * @brief 带优先级队列的执行器，在同一组工作线程内，按优先级调度任务。
+ *
+ * 每个优先级拥有独立的 FIFO 队列，工作线程总是先取最高优先级的非空队列中的任务，
+ * 因此高优先级的任务总会先于已排队的低优先级任务执行，而不需要为其单独开设线程；
+ * 但正在执行的任务不会被抢占。经由 OpExe::Post 投递的任务，其优先级取自投递时的 core::details::g_post_priority ；
+ * 其他的投递仅在来自本执行器的工作线程时（如协程在本执行器上恢复），沿用当前任务的优先级，否则使用默认优先级。
+ *
+ * 配置项：
+ *  - thread_num          工作线程数量，默认为 1
+ *  - thread_sched_policy 工作线程的调度策略
+ *  - thread_bind_cpu     工作线程绑定的 CPU 列表
+ */
+class PriorityExecutor : public aimrt::runtime::core::executor::ExecutorBase
+{
+ public:
+  struct Options {
+    std::uint32_t thread_num = 1;
+    std::string thread_sched_policy;
+    std::vector<std::uint32_t> thread_bind_cpu;
+  };
+
+  // 执行器类型名称
+  static constexpr std::string_view kType = "priority_thread";
+
+  /**
+   * @brief 向执行器管理者注册本执行器类型，需在执行器初始化之前（kPreInitExecutor）调用
+   */
+  static void Register(aimrt::runtime::core::executor::ExecutorManager& manager);
+
+  PriorityExecutor() = default;
+  ~PriorityExecutor() override;
+
+  void Initialize(std::string_view name, YAML::Node options_node) override;
+  void Start() override;
+  void Shutdown() override;
+
+  [[nodiscard]] std::string_view Type() const noexcept override { return kType; }
+  [[nodiscard]] std::string_view Name() const noexcept override { return name_; }
+
+  [[nodiscard]] bool ThreadSafe() const noexcept override { return options_.thread_num == 1; }
+  [[nodiscard]] bool IsInCurrentExecutor() const noexcept override;
+  [[nodiscard]] bool SupportTimerSchedule() const noexcept override { return true; }
+
+  void Execute(aimrt::executor::Task&& task) noexcept override;
+
+  [[nodiscard]] std::chrono::system_clock::time_point Now() const noexcept override;
+  void ExecuteAt(std::chrono::system_clock::time_point tp, aimrt::executor::Task&& task) noexcept override;
+
+  [[nodiscard]] size_t CurrentTaskNum() noexcept override;
+
+ private:
+  /**
+   * @return 当前线程上投递的任务所使用的优先级
+   */
+  [[nodiscard]] core::Priority PriorityOfPost() const;
+
+  void Push(core::Priority prio, aimrt::executor::Task&& task);
+  void WorkerLoop(std::size_t idx);
+
+ private:
+  std::string name_;
+  Options options_;
+
+  std::vector<std::thread> threads_;
+
+  // 各个优先级的任务队列，以优先级的数值为下标
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::array<std::deque<aimrt::executor::Task>, core::kPriorityCount> lanes_;
+
+  // 待执行的任务数量（不含定时任务）
+  std::atomic_size_t pending_ = 0;
+
+  // 定时任务由独立的线程按时间点投递，并保留其设定时的优先级
+  details::TimerThread timer_thread_;
+
+  bool running_ = false;
+};
+}  // namespace aimrte::runtime::executor
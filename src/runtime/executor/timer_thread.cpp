@@ -0,0 +1,70 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./timer_thread.h"
+#include "src/runtime/core/util/thread_tools.h"
+
+namespace aimrte::runtime::executor::details
+{
+TimerThread::~TimerThread()
+{
+  Stop();
+}
+
+void TimerThread::Start(std::string name, Dispatch dispatch)
+{
+  name_     = std::move(name);
+  dispatch_ = std::move(dispatch);
+  running_  = true;
+  thread_   = std::thread([this]() { Loop(); });
+}
+
+void TimerThread::Stop()
+{
+  {
+    const std::lock_guard lock(mutex_);
+    running_ = false;
+    cv_.notify_all();
+  }
+
+  if (thread_.joinable())
+    thread_.join();
+}
+
+void TimerThread::Add(const std::chrono::system_clock::time_point tp, aimrt::executor::Task&& task)
+{
+  const std::lock_guard lock(mutex_);
+
+  const bool earliest = timers_.empty() or tp < timers_.top().tp;
+  timers_.push({tp, seq_++, std::move(task)});
+
+  if (earliest)
+    cv_.notify_one();
+}
+
+void TimerThread::Loop()
+{
+  aimrt::runtime::core::util::SetNameForCurrentThread(name_);
+
+  std::unique_lock lock(mutex_);
+
+  while (running_) {
+    if (timers_.empty()) {
+      cv_.wait(lock);
+      continue;
+    }
+
+    if (const auto tp = timers_.top().tp; tp > std::chrono::system_clock::now()) {
+      cv_.wait_until(lock, tp);
+      continue;
+    }
+
+    aimrt::executor::Task task = std::move(timers_.top().task);
+    timers_.pop();
+
+    lock.unlock();
+    dispatch_(std::move(task));
+    lock.lock();
+  }
+}
+}  // namespace aimrte::runtime::executor::details
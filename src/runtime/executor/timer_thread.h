@@ -0,0 +1,76 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <queue>
+#include <string>
+#include <thread>
+#include <vector>
+#include "src/interface/aimrt_module_cpp_interface/executor/executor.h"
+
+namespace aimrte::runtime::executor::details
+{
+/**
+ * @brief 执行器的定时线程，在给定的时间点，将定时任务交给执行器投递。
+ */
+class TimerThread
+{
+ public:
+  using Dispatch = std::function<void(aimrt::executor::Task&&)>;
+
+  TimerThread() = default;
+  ~TimerThread();
+
+  TimerThread(const TimerThread&)            = delete;
+  TimerThread& operator=(const TimerThread&) = delete;
+
+  /**
+   * @brief 启动定时线程
+   * @param name     线程名称
+   * @param dispatch 定时任务到期时的投递过程，在定时线程上调用
+   */
+  void Start(std::string name, Dispatch dispatch);
+
+  /**
+   * @brief 停止定时线程，未到期的任务将被丢弃
+   */
+  void Stop();
+
+  /**
+   * @brief 添加定时任务
+   */
+  void Add(std::chrono::system_clock::time_point tp, aimrt::executor::Task&& task);
+
+ private:
+  void Loop();
+
+ private:
+  struct Timer {
+    std::chrono::system_clock::time_point tp;
+    std::uint64_t seq;
+    mutable aimrt::executor::Task task;
+
+    bool operator>(const Timer& other) const
+    {
+      return tp != other.tp ? tp > other.tp : seq > other.seq;
+    }
+  };
+
+  std::string name_;
+  Dispatch dispatch_;
+
+  std::mutex mutex_;
+  std::condition_variable cv_;
+  std::priority_queue<Timer, std::vector<Timer>, std::greater<>> timers_;
+  std::uint64_t seq_ = 0;
+  bool running_      = false;
+
+  std::thread thread_;
+};
+}  // namespace aimrte::runtime::executor::details
@@ -0,0 +1,244 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./work_stealing_executor.h"
+#include <fmt/format.h>
+#include "src/runtime/core/util/thread_tools.h"
+
+namespace aimrte::runtime::executor
+{
+namespace
+{
+// 当前线程所属的执行器，以及在其中的工作线程序号
+thread_local const WorkStealingExecutor* t_executor = nullptr;
+thread_local std::size_t t_worker_idx               = 0;
+
+// 连续执行 LIFO 槽位任务的上限，超过后先处理本地队列，避免其中的任务饥饿
+constexpr std::uint32_t kMaxLifoRuns = 16;
+}  // namespace
+
+void WorkStealingExecutor::Register(aimrt::runtime::core::executor::ExecutorManager& manager)
+{
+  manager.RegisterExecutorGenFunc(
+    kType, []() -> std::unique_ptr<aimrt::runtime::core::executor::ExecutorBase> {
+      return std::make_unique<WorkStealingExecutor>();
+    });
+}
+
+WorkStealingExecutor::~WorkStealingExecutor()
+{
+  Shutdown();
+}
+
+void WorkStealingExecutor::Initialize(const std::string_view name, YAML::Node options_node)
+{
+  name_ = name;
+
+  if (options_node and not options_node.IsNull()) {
+    if (options_node["thread_num"])
+      options_.thread_num = std::max(options_node["thread_num"].as<std::uint32_t>(), 1u);
+
+    if (options_node["thread_sched_policy"])
+      options_.thread_sched_policy = options_node["thread_sched_policy"].as<std::string>();
+
+    if (options_node["thread_bind_cpu"])
+      options_.thread_bind_cpu = options_node["thread_bind_cpu"].as<std::vector<std::uint32_t>>();
+  }
+
+  workers_.reserve(options_.thread_num);
+  for (std::uint32_t i = 0; i < options_.thread_num; ++i)
+    workers_.push_back(std::make_unique<Worker>());
+}
+
+void WorkStealingExecutor::Start()
+{
+  if (running_.exchange(true))
+    return;
+
+  threads_.reserve(workers_.size());
+  for (std::size_t i = 0; i < workers_.size(); ++i)
+    threads_.emplace_back([this, i]() { WorkerLoop(i); });
+
+  timer_thread_.Start(fmt::format("{}.timer", name_), [this](aimrt::executor::Task&& task) { Execute(std::move(task)); });
+}
+
+void WorkStealingExecutor::Shutdown()
+{
+  if (not running_.exchange(false))
+    return;
+
+  timer_thread_.Stop();
+
+  {
+    const std::lock_guard lock(park_mutex_);
+    park_cv_.notify_all();
+  }
+
+  for (std::thread& thread : threads_)
+    thread.join();
+
+  threads_.clear();
+}
+
+bool WorkStealingExecutor::IsInCurrentExecutor() const noexcept
+{
+  return t_executor == this;
+}
+
+void WorkStealingExecutor::Execute(aimrt::executor::Task&& task) noexcept
+{
+  pending_.fetch_add(1);
+
+  // 工作线程内投递的任务放入 LIFO 槽位，原槽位中的任务退回本地队列，可被其他线程窃取
+  if (t_executor == this) {
+    Worker& worker = *workers_[t_worker_idx];
+
+    if (not worker.lifo_slot.has_value()) {
+      worker.lifo_slot.emplace(std::move(task));
+      return;
+    }
+
+    Push(t_worker_idx, std::move(*std::exchange(worker.lifo_slot, std::move(task))));
+  } else {
+    Push(next_worker_.fetch_add(1, std::memory_order_relaxed) % workers_.size(), std::move(task));
+  }
+
+  WakeOne();
+}
+
+std::chrono::system_clock::time_point WorkStealingExecutor::Now() const noexcept
+{
+  return std::chrono::system_clock::now();
+}
+
+void WorkStealingExecutor::ExecuteAt(const std::chrono::system_clock::time_point tp, aimrt::executor::Task&& task) noexcept
+{
+  timer_thread_.Add(tp, std::move(task));
+}
+
+size_t WorkStealingExecutor::CurrentTaskNum() noexcept
+{
+  return pending_.load(std::memory_order_relaxed);
+}
+
+void WorkStealingExecutor::Push(const std::size_t idx, aimrt::executor::Task&& task)
+{
+  Worker& worker = *workers_[idx];
+
+  {
+    const std::lock_guard lock(worker.mutex);
+    worker.queue.push_back(std::move(task));
+  }
+
+  queued_.fetch_add(1);
+}
+
+void WorkStealingExecutor::WakeOne()
+{
+  if (parked_.load() == 0)
+    return;
+
+  // 经过锁，以免与正在进入休眠的线程错过通知
+  const std::lock_guard lock(park_mutex_);
+  park_cv_.notify_one();
+}
+
+std::optional<aimrt::executor::Task> WorkStealingExecutor::Pop(const std::size_t idx)
+{
+  Worker& worker = *workers_[idx];
+
+  if (worker.lifo_slot.has_value()) {
+    if (worker.lifo_runs < kMaxLifoRuns) {
+      ++worker.lifo_runs;
+      return std::exchange(worker.lifo_slot, std::nullopt);
+    }
+
+    // 连续执行 LIFO 任务过多，将其退回本地队列末尾，先处理队列中更早的任务
+    Push(idx, std::move(*std::exchange(worker.lifo_slot, std::nullopt)));
+  }
+
+  worker.lifo_runs = 0;
+
+  const std::lock_guard lock(worker.mutex);
+  if (worker.queue.empty())
+    return std::nullopt;
+
+  aimrt::executor::Task task = std::move(worker.queue.front());
+  worker.queue.pop_front();
+  queued_.fetch_sub(1);
+  return task;
+}
+
+std::optional<aimrt::executor::Task> WorkStealingExecutor::Steal(const std::size_t idx)
+{
+  const std::size_t n = workers_.size();
+
+  for (std::size_t k = 1; k < n; ++k) {
+    Worker& victim = *workers_[(idx + k) % n];
+    std::vector<aimrt::executor::Task> batch;
+
+    {
+      const std::lock_guard lock(victim.mutex);
+      if (victim.queue.empty())
+        continue;
+
+      // 取走对方队列中较早的一半任务，减少之后的窃取次数
+      const std::size_t count = (victim.queue.size() + 1) / 2;
+      batch.reserve(count);
+      for (std::size_t i = 0; i < count; ++i) {
+        batch.push_back(std::move(victim.queue.front()));
+        victim.queue.pop_front();
+      }
+    }
+
+    aimrt::executor::Task task = std::move(batch.front());
+    queued_.fetch_sub(1);
+
+    if (batch.size() > 1) {
+      Worker& self = *workers_[idx];
+      const std::lock_guard lock(self.mutex);
+      for (std::size_t i = 1; i < batch.size(); ++i)
+        self.queue.push_back(std::move(batch[i]));
+    }
+
+    return task;
+  }
+
+  return std::nullopt;
+}
+
+void WorkStealingExecutor::WorkerLoop(const std::size_t idx)
+{
+  t_executor   = this;
+  t_worker_idx = idx;
+
+  aimrt::runtime::core::util::SetNameForCurrentThread(fmt::format("{}.{}", name_, idx));
+  aimrt::runtime::core::util::BindCpuForCurrentThread(options_.thread_bind_cpu);
+  aimrt::runtime::core::util::SetCpuSchedForCurrentThread(options_.thread_sched_policy);
+
+  while (true) {
+    std::optional<aimrt::executor::Task> task = Pop(idx);
+    if (not task.has_value())
+      task = Steal(idx);
+
+    if (task.has_value()) {
+      pending_.fetch_sub(1);
+      (*task)();
+      continue;
+    }
+
+    std::unique_lock lock(park_mutex_);
+
+    // 退出时，仍需处理完队列中的任务；其他线程 LIFO 槽位中的任务由它们自己处理
+    if (not running_ and queued_.load() == 0)
+      break;
+
+    parked_.fetch_add(1);
+    park_cv_.wait(lock, [this]() { return queued_.load() > 0 or not running_; });
+    parked_.fetch_sub(1);
+  }
+
+  t_executor = nullptr;
+}
+
+}  // namespace aimrte::runtime::executor
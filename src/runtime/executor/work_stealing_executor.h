@@ -0,0 +1,118 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <thread>
+#include <vector>
+#include "src/runtime/core/executor/executor_base.h"
+#include "src/runtime/core/executor/executor_manager.h"
+#include "./timer_thread.h"
+
+namespace aimrte::runtime::executor
+{
+/**
+ * @brief 工作窃取的执行器，适用于大量细粒度协程的扇出场景。
+ *
+ * 每个工作线程拥有自己的任务队列与一个 LIFO 槽位：工作线程内投递的任务（通常是刚被唤醒的协程的后续）
+ * 先放入 LIFO 槽位，以便被立即执行、保持缓存热度，原槽位中的任务退回本地队列；外部线程投递的任务
+ * 轮流分发到各个工作线程的队列。空闲的工作线程从其他线程的队列头部窃取任务，仍无任务时休眠。
+ *
+ * 配置项：
+ *  - thread_num          工作线程数量，默认为 1
+ *  - thread_sched_policy 工作线程的调度策略
+ *  - thread_bind_cpu     工作线程绑定的 CPU 列表
+ */
+class WorkStealingExecutor : public aimrt::runtime::core::executor::ExecutorBase
+{
+ public:
+  struct Options {
+    std::uint32_t thread_num = 1;
+    std::string thread_sched_policy;
+    std::vector<std::uint32_t> thread_bind_cpu;
+  };
+
+  // 执行器类型名称
+  static constexpr std::string_view kType = "work_stealing";
+
+  /**
+   * @brief 向执行器管理者注册本执行器类型，需在执行器初始化之前（kPreInitExecutor）调用
+   */
+  static void Register(aimrt::runtime::core::executor::ExecutorManager& manager);
+
+  WorkStealingExecutor() = default;
+  ~WorkStealingExecutor() override;
+
+  void Initialize(std::string_view name, YAML::Node options_node) override;
+  void Start() override;
+  void Shutdown() override;
+
+  [[nodiscard]] std::string_view Type() const noexcept override { return kType; }
+  [[nodiscard]] std::string_view Name() const noexcept override { return name_; }
+
+  [[nodiscard]] bool ThreadSafe() const noexcept override { return options_.thread_num == 1; }
+  [[nodiscard]] bool IsInCurrentExecutor() const noexcept override;
+  [[nodiscard]] bool SupportTimerSchedule() const noexcept override { return true; }
+
+  void Execute(aimrt::executor::Task&& task) noexcept override;
+
+  [[nodiscard]] std::chrono::system_clock::time_point Now() const noexcept override;
+  void ExecuteAt(std::chrono::system_clock::time_point tp, aimrt::executor::Task&& task) noexcept override;
+
+  [[nodiscard]] size_t CurrentTaskNum() noexcept override;
+
+ private:
+  // 单个工作线程的任务队列
+  struct Worker {
+    std::mutex mutex;
+    std::deque<aimrt::executor::Task> queue;
+
+    // 仅由本工作线程访问
+    std::optional<aimrt::executor::Task> lifo_slot;
+
+    // 连续执行 LIFO 槽位任务的次数，用于避免本地队列饥饿
+    std::uint32_t lifo_runs = 0;
+  };
+
+  void WorkerLoop(std::size_t idx);
+
+  std::optional<aimrt::executor::Task> Pop(std::size_t idx);
+  std::optional<aimrt::executor::Task> Steal(std::size_t idx);
+
+  void Push(std::size_t idx, aimrt::executor::Task&& task);
+  void WakeOne();
+
+ private:
+  std::string name_;
+  Options options_;
+
+  std::vector<std::unique_ptr<Worker>> workers_;
+  std::vector<std::thread> threads_;
+
+  // 待执行的任务数量（不含定时任务）
+  std::atomic_size_t pending_ = 0;
+
+  // 位于各个队列中、可被窃取的任务数量，空闲的工作线程据此休眠与唤醒
+  std::atomic_size_t queued_ = 0;
+
+  // 外部线程投递任务时的轮转游标
+  std::atomic_size_t next_worker_ = 0;
+
+  // 空闲工作线程的休眠与唤醒
+  std::mutex park_mutex_;
+  std::condition_variable park_cv_;
+  std::atomic_size_t parked_ = 0;
+
+  // 定时任务由独立的线程按时间点投递到工作线程
+  details::TimerThread timer_thread_;
+
+  std::atomic_bool running_ = false;
+};
+}  // namespace aimrte::runtime::executor
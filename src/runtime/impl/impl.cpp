@@ -2,6 +2,8 @@
 // All rights reserved.
 
 #include "src/runtime/core/aimrt_core.h"
+#include "src/runtime/executor/priority_executor.h"
+#include "src/runtime/executor/work_stealing_executor.h"
 #include "src/runtime/internal/internal.h"
 #include <chrono>
 #include <thread>
@@ -11,6 +13,17 @@ namespace aimrte::runtime
 class Core final : public ICore
 {
  public:
+  Core()
+  {
+    // 注册 aimrte 提供的执行器类型
+    impl_.RegisterHookFunc(
+      aimrt::runtime::core::AimRTCore::State::kPreInitExecutor,
+      [this]() {
+        executor::WorkStealingExecutor::Register(impl_.GetExecutorManager());
+        executor::PriorityExecutor::Register(impl_.GetExecutorManager());
+      });
+  }
+
   void RegisterHook(State state, std::function<void()> func) override
   {
     impl_.RegisterHookFunc(static_cast<aimrt::runtime::core::AimRTCore::State>(state), std::move(func));
@@ -0,0 +1,81 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./adaptive_mutex.h"
+#include <algorithm>
+#include "./details/cpu_relax.h"
+
+namespace aimrte::sync
+{
+bool AdaptiveMutex::TryLock()
+{
+  if (not impl_.TryLock())
+    return false;
+
+  acquisitions_.fetch_add(1, std::memory_order_relaxed);
+  return true;
+}
+
+co::Task<void> AdaptiveMutex::Lock()
+{
+  if (TryLock())
+    co_return;
+
+  contended_.fetch_add(1, std::memory_order_relaxed);
+  const auto begin = std::chrono::steady_clock::now();
+
+  if (SpinLock()) {
+    spun_.fetch_add(1, std::memory_order_relaxed);
+  } else {
+    parked_.fetch_add(1, std::memory_order_relaxed);
+    co_await impl_.Lock();
+  }
+
+  acquisitions_.fetch_add(1, std::memory_order_relaxed);
+  total_wait_.fetch_add(std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count(), std::memory_order_relaxed);
+}
+
+co::Task<std::unique_lock<AdaptiveMutex>> AdaptiveMutex::ScopedLock()
+{
+  co_await Lock();
+  co_return std::unique_lock(*this, std::adopt_lock);
+}
+
+void AdaptiveMutex::Unlock()
+{
+  impl_.Unlock();
+}
+
+MutexStats AdaptiveMutex::GetStats() const
+{
+  return {
+    .acquisitions = acquisitions_.load(std::memory_order_relaxed),
+    .contended    = contended_.load(std::memory_order_relaxed),
+    .spun         = spun_.load(std::memory_order_relaxed),
+    .parked       = parked_.load(std::memory_order_relaxed),
+    .total_wait   = std::chrono::nanoseconds(total_wait_.load(std::memory_order_relaxed)),
+  };
+}
+
+bool AdaptiveMutex::SpinLock()
+{
+  // 允许的自旋次数为以往平均值的两倍，并保留少量余地，使其在锁域变长后仍有机会重新适应
+  const std::uint32_t avg   = spin_avg_.load(std::memory_order_relaxed);
+  const std::uint32_t limit = std::min(avg * 2 + 10, kMaxSpin);
+
+  for (std::uint32_t n = 1; n <= limit; ++n) {
+    details::CpuRelax();
+
+    if (impl_.TryLock()) {
+      // 滑动平均：avg += (n - avg) / 8
+      const std::int64_t next = avg + (static_cast<std::int64_t>(n) - static_cast<std::int64_t>(avg)) / 8;
+      spin_avg_.store(static_cast<std::uint32_t>(next), std::memory_order_relaxed);
+      return true;
+    }
+  }
+
+  // 自旋失败，逐渐减少下一次的自旋次数
+  spin_avg_.store(avg - avg / 8, std::memory_order_relaxed);
+  return false;
+}
+}  // namespace aimrte::sync
@@ -0,0 +1,99 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include "src/core/coroutine.h"
+#include "./mutex.h"
+
+namespace aimrte::sync
+{
+/**
+ * @brief 互斥量的竞争统计数据快照
+ */
+struct MutexStats {
+  // 加锁次数
+  std::uint64_t acquisitions = 0;
+
+  // 未能立即加锁的次数
+  std::uint64_t contended = 0;
+
+  // 其中，在自旋期间加锁成功的次数
+  std::uint64_t spun = 0;
+
+  // 其中，挂起协程排队等待的次数
+  std::uint64_t parked = 0;
+
+  // 未能立即加锁时，累计的等待时间
+  std::chrono::nanoseconds total_wait{};
+};
+
+/**
+ * @brief 自适应的协程互斥量：加锁失败时先短暂自旋（使用 CPU 的 pause 指令），仍失败时再挂起协程，
+ *        进入 v2::Mutex 的等待队列。自旋的次数根据以往自旋成功所需的次数动态调整，
+ *        使其适应锁域的长短：锁域很短时自旋即可拿到锁，避免挂起与唤醒的开销；锁域较长时尽快挂起，避免空转。
+ *        同时记录竞争的统计数据，供性能分析使用。
+ */
+class AdaptiveMutex
+{
+ public:
+  // 自旋次数的上限
+  static constexpr std::uint32_t kMaxSpin = 1000;
+
+  AdaptiveMutex() = default;
+
+  /**
+   * @brief 尝试加锁，返回成功与否
+   */
+  bool TryLock();
+
+  /**
+   * @brief 加锁本互斥量
+   */
+  co::Task<void> Lock();
+
+  /**
+   * @brief 加锁本互斥量，并返回一个自动解锁的对象
+   */
+  co::Task<std::unique_lock<AdaptiveMutex>> ScopedLock();
+
+  /**
+   * @brief 解锁本互斥量
+   */
+  void Unlock();
+
+  /**
+   * @return 本互斥量的竞争统计数据
+   */
+  [[nodiscard]] MutexStats GetStats() const;
+
+ public:
+  // 为 std::unique_lock 提供接口
+  void lock() { Lock().Sync(); }
+  void unlock() { Unlock(); }
+
+ private:
+  /**
+   * @brief 自旋等待加锁
+   * @return 是否在自旋期间加锁成功
+   */
+  bool SpinLock();
+
+ private:
+  v2::Mutex impl_;
+
+  // 以往自旋成功所需次数的滑动平均值，决定下一次自旋的次数
+  std::atomic_uint32_t spin_avg_ = 0;
+
+  // 竞争统计
+  std::atomic_uint64_t acquisitions_ = 0;
+  std::atomic_uint64_t contended_    = 0;
+  std::atomic_uint64_t spun_         = 0;
+  std::atomic_uint64_t parked_       = 0;
+  std::atomic_int64_t total_wait_    = 0;
+};
+}  // namespace aimrte::sync
@@ -0,0 +1,59 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./test/common.h"
+#include "src/sync/sync.h"
+
+namespace aimrte::test
+{
+TEST_F(SyncTest, AdaptiveMutexBasicUsage)
+{
+  SyncMutexBasicUsage<sync::AdaptiveMutex>(*this);
+}
+
+TEST_F(SyncTest, AdaptiveMutexLotsOfParallel)
+{
+  SyncMutexLotsOfParallel<sync::AdaptiveMutex>(*this);
+}
+
+TEST_F(SyncTest, AdaptiveMutexMacro)
+{
+  SyncMutexMacro<sync::AdaptiveMutex>(*this);
+}
+
+TEST_F(SyncTest, AdaptiveMutexStats)
+{
+  sync::AdaptiveMutex mutex;
+
+  GTEST_ASSERT_TRUE(mutex.TryLock());
+  GTEST_ASSERT_FALSE(mutex.TryLock());
+  mutex.Unlock();
+
+  // 持有锁较长时间，使其他线程上的加锁者自旋失败而挂起
+  mutex.lock();
+
+  std::atomic_int done = 0;
+  for (int i = 0; i < 4; ++i) {
+    exe.Post(
+      [&]() -> co::Task<void> {
+        co_await mutex.Lock();
+        mutex.Unlock();
+        done.fetch_add(1);
+      });
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  mutex.unlock();
+
+  for (int i = 0; i < 100 and done.load() < 4; ++i)
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+
+  GTEST_ASSERT_EQ(done.load(), 4);
+
+  const sync::MutexStats stats = mutex.GetStats();
+  GTEST_ASSERT_EQ(stats.acquisitions, 6);
+  GTEST_ASSERT_EQ(stats.contended, stats.spun + stats.parked);
+  GTEST_ASSERT_GE(stats.parked, 1);
+  GTEST_ASSERT_GE(stats.total_wait, std::chrono::milliseconds(1));
+}
+}  // namespace aimrte::test
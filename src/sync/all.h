@@ -0,0 +1,213 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <optional>
+#include <tuple>
+#include "src/core/core.h"
+#include "src/ctx/ctx.h"
+#include "src/panic/panic.h"
+
+#include "./details/coroutine_decorator.h"
+#include "./details/void.h"
+
+namespace aimrte::sync
+{
+/**
+ * @brief 并发地执行所有给定的协程，等待它们全部结束，按给定的顺序返回它们的结果。
+ *
+ * 与 sync::any 相同，可通过 In(scope) 指定协程所在的 AsyncScope ，通过 Via(exe) 指定执行它们的执行器，
+ * 全部结束后，在调用者原本所在的执行器上继续执行。
+ * 各个协程通过同一个完成计数会合，最后一个结束的协程负责唤醒调用者。
+ * 由于调用者在所有协程结束之前都不会继续执行，共享的状态直接存放在本对象中，无需额外分配。
+ */
+template <class... TTasks>
+class all : std::tuple<TTasks&&...>
+{
+  static_assert(sizeof...(TTasks) != 0);
+  using Base = std::tuple<TTasks&&...>;
+
+  template <class E>
+  struct TaskTypeTrait {
+    using Task         = E;
+    using DecayTask    = std::remove_reference_t<Task>;
+    using MiddleResult = typename co::details::MiddleReturnValueTypeTrait<DecayTask>::Type;
+    using RawResult    = typename co::details::ReturnValueTypeTrait<DecayTask>::Type;
+    using Result       = std::conditional_t<std::is_void_v<RawResult>, Void, RawResult>;
+  };
+
+  template <std::size_t I>
+  struct TypeTrait : TaskTypeTrait<std::tuple_element_t<I, Base>> {
+  };
+
+  using Result = std::tuple<typename TaskTypeTrait<TTasks>::Result...>;
+
+ public:
+  explicit all(TTasks&&... tasks)
+      : Base(std::forward<TTasks>(tasks)...)
+  {
+    // 检查当前是否在执行器环境下运行本 all 操作，如果不是，需要报错
+    if (not curr_exe_.IsValid())
+      panic().wtf(R"(Never use aimrte::sync::all outside of aimrte::ctx::Executor !)");
+  }
+
+  all&& In(aimrt::co::AsyncScope& scope) &&
+  {
+    scope_ = &scope;
+    return std::move(*this);
+  }
+
+  all&& Via(res::Executor exe) &&
+  {
+    exe_ = std::move(exe);
+    return std::move(*this);
+  }
+
+  constexpr static bool await_ready()
+  {
+    return false;
+  }
+
+  bool await_suspend(std::coroutine_handle<> continuation)
+  {
+    // 预先取得原执行器的句柄，唤醒时直接向其投递，无需在唤醒者的线程上查找上下文
+    ctx_.continuation      = continuation;
+    ctx_.original_executor = core::details::GetExecutor(curr_exe_, std::source_location::current());
+
+    DoSuspend(std::make_index_sequence<sizeof...(TTasks)>());
+
+    // 释放本协程持有的一份计数，若所有的协程都已在此之前结束，则原地继续执行
+    return not ctx_.Arrive();
+  }
+
+  Result await_resume()
+  {
+    return std::apply(
+      [](auto&... results) {
+        return Result{std::move(results).value()...};
+      },
+      ctx_.results);
+  }
+
+ private:
+  template <std::size_t... I>
+  void DoSuspend(std::index_sequence<I...>)
+  {
+    // 先取出 sender ，目的是为了将 Task 中的 used 标记为 true，避免因为协程不被调度，从而出现未使用协程错误
+    auto into_sender_and_handler = []<class Task>(Task&& task) {
+      return std::tuple{
+        co::details::IntoMiddleSender(std::forward<Task>(task)),
+        co::details::IntoFinalHandler(std::forward<Task>(task)),
+      };
+    };
+
+    std::tuple sender_and_handlers = {
+      into_sender_and_handler(std::forward<typename TypeTrait<I>::Task>(std::get<I>(*this)))...};
+
+    (CallDoSuspend<I>(std::get<I>(std::move(sender_and_handlers))), ...);
+  }
+
+  template <std::size_t I, class ETuple>
+  void CallDoSuspend(ETuple&& tuple)
+  {
+    DoSuspend<I>(std::get<0>(std::forward<ETuple>(tuple)), std::get<1>(std::forward<ETuple>(tuple)));
+  }
+
+  template <std::size_t I, class MiddleSender, class FinalHandler>
+  void DoSuspend(MiddleSender&& middle_sender, FinalHandler&& final_handler)
+  {
+    using MiddleResult = typename TypeTrait<I>::MiddleResult;
+    using RawResult    = typename TypeTrait<I>::RawResult;
+
+    // 各协程仅写入属于自己的结果，再释放一份计数，最后一个结束的协程唤醒调用者
+    if constexpr (std::is_void_v<MiddleResult>) {
+      Spawn(
+        unifex::then(
+          std::forward<MiddleSender>(middle_sender),
+          [ctx{&ctx_}, final_handler{std::forward<FinalHandler>(final_handler)}]() {
+            if constexpr (std::is_void_v<RawResult>) {
+              final_handler();
+              ctx->template SetResultAndArrive<I>(Void{});
+            } else {
+              ctx->template SetResultAndArrive<I>(final_handler());
+            }
+          }));
+    } else {
+      Spawn(
+        unifex::then(
+          std::forward<MiddleSender>(middle_sender),
+          [ctx{&ctx_}, final_handler{std::forward<FinalHandler>(final_handler)}](MiddleResult&& value) {
+            if constexpr (std::is_void_v<RawResult>) {
+              final_handler(std::move(value));
+              ctx->template SetResultAndArrive<I>(Void{});
+            } else {
+              ctx->template SetResultAndArrive<I>(final_handler(std::move(value)));
+            }
+          }));
+    }
+  }
+
+  template <class Sender>
+  void Spawn(Sender&& sender, AIMRTE(src(loc)))
+  {
+    if (exe_.IsValid())
+      scope_->spawn_on(core::details::GetScheduler(exe_, loc), std::forward<Sender>(sender));
+    else
+      scope_->spawn(std::forward<Sender>(sender));
+  }
+
+ private:
+  static aimrt::co::AsyncScope& GetGlobalScope()
+  {
+    return core::Context::GetAsyncScope(*core::details::ExpectContext(std::source_location::current()));
+  }
+
+  struct Context {
+    std::coroutine_handle<> continuation;
+    aimrt::executor::ExecutorRef original_executor;
+
+    std::tuple<std::optional<typename TaskTypeTrait<TTasks>::Result>...> results;
+
+    // 尚未结束的协程数量，外加 await_suspend 持有的一份，避免在发起所有协程之前被唤醒
+    std::atomic_size_t remaining{sizeof...(TTasks) + 1};
+
+    /**
+     * @return 是否是最后一个到达者
+     */
+    bool Arrive()
+    {
+      return remaining.fetch_sub(1, std::memory_order::acq_rel) == 1;
+    }
+
+    template <std::size_t I, class Ri>
+    void SetResultAndArrive(Ri&& value)
+    {
+      std::get<I>(results).emplace(std::forward<Ri>(value));
+
+      // 此后本对象可能随时被销毁，除最后一个到达者外，不能再访问
+      if (not Arrive())
+        return;
+
+      if (original_executor)
+        original_executor.Execute([h{continuation}]() {
+          h.resume();
+        });
+      else
+        continuation.resume();
+    }
+  };
+
+  // 使用当前所在的执行器，在 all 被 resume 时继续所在协程的执行
+  res::Executor curr_exe_{core::details::g_thread_ctx->exe};
+
+  // all 等待的若干协程执行环境以及相关参数
+  aimrt::co::AsyncScope* scope_{&GetGlobalScope()};
+  res::Executor exe_{curr_exe_};
+
+  // 这些协程以及 all 所在协程共同使用的一份上下文数据，在所有协程结束之前，本对象不会被销毁
+  Context ctx_;
+};
+}  // namespace aimrte::sync
@@ -0,0 +1,93 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./test/common.h"
+#include "src/sync/sync.h"
+#include <string>
+
+namespace aimrte::test
+{
+namespace
+{
+template <class T>
+co::Task<T> CoTask(T n, const int ms)
+{
+  co_await ctx::Sleep(std::chrono::milliseconds(ms));
+  co_return n;
+}
+
+co::Task<void> CoTask(std::atomic_int& sum, const int n)
+{
+  sum += n;
+  co_return;
+}
+}  // namespace
+
+TEST_F(SyncTest, AllBasicUsage)
+{
+  std::atomic_int sum{0};
+  bool flag = false;
+
+  thread_safe_exe.Inline(
+    [&]() -> co::Task<void> {
+      std::tuple<int, double, std::string, Void> result = co_await sync::all{
+        CoTask<int>(1, 0),
+        CoTask<double>(2.0, 0),
+        CoTask<std::string>("3", 0),
+        CoTask(sum, 4),
+      };
+
+      if (std::get<0>(result) == 1 and std::get<1>(result) == 2.0 and std::get<2>(result) == "3" and sum.load() == 4)
+        flag = true;
+    });
+
+  GTEST_EXPECT_TRUE(flag);
+}
+
+TEST_F(SyncTest, AllRunsConcurrently)
+{
+  std::tuple<int, int, int> result;
+  std::chrono::steady_clock::duration cost{};
+
+  exe.Inline(
+    [&]() -> co::Task<void> {
+      const auto start = std::chrono::steady_clock::now();
+
+      result = co_await sync::all{
+        CoTask<int>(1, 300),
+        CoTask<int>(2, 100),
+        CoTask<int>(3, 200),
+      }
+                 .Via(thread_safe_exe);
+
+      cost = std::chrono::steady_clock::now() - start;
+    });
+
+  // 结果按给定的顺序排列，且总耗时取决于最慢的协程，而非各协程耗时之和
+  GTEST_ASSERT_EQ(result, std::tuple(1, 2, 3));
+  GTEST_ASSERT_LT(cost, std::chrono::milliseconds(550));
+}
+
+TEST_F(SyncTest, AllUseFinalHandler)
+{
+  std::atomic_int sum{0};
+  co::AsyncScope scope;
+
+  exe.Inline(
+    [&]() -> co::Task<void> {
+      co_await sync::all{
+        CoTask<int>(2, 0) | [&](const int value) {
+          sum += value;
+        },
+        CoTask<int>(3, 0) | [&](const int value) {
+          sum += value;
+        },
+      }
+        .In(scope);
+
+      scope.Complete();
+    });
+
+  GTEST_ASSERT_EQ(sum.load(), 5);
+}
+}  // namespace aimrte::test
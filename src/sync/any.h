@@ -4,8 +4,13 @@
 #pragma once
 
 
+#include <atomic>
 #include <coroutine>
+#include <memory>
+#include <optional>
 #include <tuple>
+#include <unifex/inplace_stop_token.hpp>
+#include <unifex/with_query_value.hpp>
 #include <variant>
 #include "src/container/indexed_variant.h"
 #include "src/core/core.h"
@@ -13,15 +18,17 @@
 #include "src/panic/panic.h"
 
 #include "./details/coroutine_decorator.h"
-
-namespace aimrte
-{
-struct Void {
-};
-}  // namespace aimrte
+#include "./details/void.h"
 
 namespace aimrte::sync
 {
+/**
+ * @brief 并发地执行所有给定的协程，返回最先结束的协程的结果。
+ *
+ * 最先结束的协程唤醒调用者，并请求停止其余的协程：它们经由停止令牌（co::StopToken）收到取消请求，
+ * 未响应取消的协程仍会执行完毕，但其结果与最终处理函数将被丢弃；尚未被发起的协程则不再发起。
+ * 调用者与各个协程共享的上下文从内存池中申请，由侵入式的计数管理，在最后一方释放时归还。
+ */
 template <class... TTasks>
 class any : std::tuple<TTasks&&...>
 {
@@ -35,8 +42,6 @@ class any : std::tuple<TTasks&&...>
     using MiddleResult = typename co::details::MiddleReturnValueTypeTrait<DecayTask>::Type;
     using RawResult    = typename co::details::ReturnValueTypeTrait<DecayTask>::Type;
     using Result       = std::conditional_t<std::is_void_v<RawResult>, Void, RawResult>;
-
-    constexpr static bool has_executor = co::details::has_executor<DecayTask>;
   };
 
   template <std::size_t I>
@@ -54,6 +59,15 @@ class any : std::tuple<TTasks&&...>
       panic().wtf(R"(Never use aimrte::sync::any outside of aimrte::ctx::Executor !)");
   }
 
+  any(const any&)            = delete;
+  any& operator=(const any&) = delete;
+
+  ~any()
+  {
+    if (ctx_ != nullptr)
+      ctx_->Release();
+  }
+
   any&& In(aimrt::co::AsyncScope& scope) &&
   {
     scope_ = &scope;
@@ -73,13 +87,19 @@ class any : std::tuple<TTasks&&...>
 
   bool await_suspend(std::coroutine_handle<> continuation)
   {
-    ctx_ = std::make_shared<Context>(continuation, std::move(curr_exe_));
-    DoSuspend(std::make_index_sequence<sizeof...(TTasks)>());
+    // 预先取得原执行器的句柄，唤醒时直接向其投递，无需在唤醒者的线程上查找上下文
+    ctx_ = new Context(continuation, core::details::GetExecutor(curr_exe_, std::source_location::current()));
+
+    // 若调用方可被取消，将其取消请求转发给各个协程
+    ctx_->ForwardStop(scope_->get_stop_token());
 
-    if (ctx_->Done())
-      return not ctx_->inline_resume;
+    // 一次性为所有的协程预留计数，而非逐个增加，未被发起的协程的计数在之后一并归还
+    const std::size_t spawned = DoSuspend(std::make_index_sequence<sizeof...(TTasks)>());
+    if (spawned != sizeof...(TTasks))
+      ctx_->Release(sizeof...(TTasks) - spawned);
 
-    return true;
+    // 与结束的协程会合，若它已先到达，则原地继续执行
+    return not ctx_->Arrive();
   }
 
   Result await_resume()
@@ -88,8 +108,11 @@ class any : std::tuple<TTasks&&...>
   }
 
  private:
+  /**
+   * @return 被发起的协程数量。一旦有协程结束，其后的协程将不再被发起
+   */
   template <std::size_t... I>
-  void DoSuspend(std::index_sequence<I...>)
+  std::size_t DoSuspend(std::index_sequence<I...>)
   {
     // 先取出 sender ，目的是为了将 Task 中的 used 标记为 true，避免因为协程不被调度，从而出现未使用协程错误
     auto into_sender_and_handler = []<class Task>(Task&& task) {
@@ -102,7 +125,9 @@ class any : std::tuple<TTasks&&...>
     std::tuple sender_and_handlers = {
       into_sender_and_handler(std::forward<typename TypeTrait<I>::Task>(std::get<I>(*this)))...};
 
-    (CallDoSuspend<I>(std::get<I>(std::move(sender_and_handlers))), ...);
+    std::size_t spawned = 0;
+    ((ctx_->Done() or (CallDoSuspend<I>(std::get<I>(std::move(sender_and_handlers))), ++spawned, false)) or ...);
+    return spawned;
   }
 
   template <std::size_t I, class ETuple>
@@ -117,38 +142,34 @@ class any : std::tuple<TTasks&&...>
     using MiddleResult = typename TypeTrait<I>::MiddleResult;
     using RawResult    = typename TypeTrait<I>::RawResult;
 
-    // 若当前该任务没有调度出去执行，则该任务会在此处执行到结束，我们需要避免它将本协程直接 resume，
-    // 从而导致在该协程后的协程得不到调度
-    const bool is_inline = not(TypeTrait<I>::has_executor or exe_.IsValid());
-
     if constexpr (std::is_void_v<MiddleResult>) {
       Spawn(
         unifex::then(
           std::forward<MiddleSender>(middle_sender),
-          [ctx{ctx_}, final_handler{std::forward<FinalHandler>(final_handler)}, is_inline]() {
+          [ctx{Ref(ctx_)}, final_handler{std::forward<FinalHandler>(final_handler)}]() {
             if (not ctx->TryResume())
               return;
 
             if constexpr (std::is_void_v<RawResult>) {
               final_handler();
-              ctx->template SetResultAndResume<I>(Void{}, is_inline);
+              ctx->template SetResultAndResume<I>(Void{});
             } else {
-              ctx->template SetResultAndResume<I>(final_handler(), is_inline);
+              ctx->template SetResultAndResume<I>(final_handler());
             }
           }));
     } else {
       Spawn(
         unifex::then(
           std::forward<MiddleSender>(middle_sender),
-          [ctx{ctx_}, final_handler{std::forward<FinalHandler>(final_handler)}, is_inline](MiddleResult&& value) {
+          [ctx{Ref(ctx_)}, final_handler{std::forward<FinalHandler>(final_handler)}](MiddleResult&& value) {
             if (not ctx->TryResume())
               return;
 
             if constexpr (std::is_void_v<RawResult>) {
               final_handler(std::move(value));
-              ctx->template SetResultAndResume<I>(Void{}, is_inline);
+              ctx->template SetResultAndResume<I>(Void{});
             } else {
-              ctx->template SetResultAndResume<I>(final_handler(std::move(value)), is_inline);
+              ctx->template SetResultAndResume<I>(final_handler(std::move(value)));
             }
           }));
     }
@@ -157,10 +178,14 @@ class any : std::tuple<TTasks&&...>
   template <class Sender>
   void Spawn(Sender&& sender, AIMRTE(src(loc)))
   {
+    // 各协程使用本 any 的停止令牌，以便在有协程结束后取消其余的协程
+    auto stoppable = unifex::with_query_value(
+      std::forward<Sender>(sender), unifex::get_stop_token, ctx_->stop_source.get_token());
+
     if (exe_.IsValid())
-      scope_->spawn_on(core::details::GetScheduler(exe_, loc), std::forward<Sender>(sender));
+      scope_->spawn_on(core::details::GetScheduler(exe_, loc), std::move(stoppable));
     else
-      scope_->spawn(std::forward<Sender>(sender));
+      scope_->spawn(std::move(stoppable));
   }
 
  private:
@@ -170,15 +195,69 @@ class any : std::tuple<TTasks&&...>
   }
 
   struct Context {
+    // 上下文的尺寸在编译期确定，从按尺寸分级的内存池中申请，避免每次 any 都经由全局堆
+    static void* operator new(const std::size_t size)
+    {
+      return core::details::BlockPool::Allocate(size);
+    }
+
+    static void operator delete(void* ptr, const std::size_t size) noexcept
+    {
+      core::details::BlockPool::Deallocate(ptr, size);
+    }
+
+    Context(const std::coroutine_handle<> continuation, const aimrt::executor::ExecutorRef original_executor)
+        : continuation(continuation), original_executor(original_executor)
+    {
+    }
+
     std::coroutine_handle<> continuation;
-    res::Executor original_executor;
+    aimrt::executor::ExecutorRef original_executor;
 
     // 标记处理结果
     std::atomic_bool used{false};
     std::optional<Result> result;
 
-    // 决定 any 的协程是否原地继续执行（若有协程在 any suspend 过程中执行完毕时，将设置该值）
-    bool inline_resume{false};
+    // 调用者的挂起与最先结束的协程在此会合，后到达的一方负责继续调用者的执行。
+    // 因此在 any 的挂起过程中原地执行完毕的协程不会直接 resume 调用者，避免其后的协程得不到调度
+    std::atomic_int gate{2};
+
+    // 调用者与每个协程各持有一份，最后释放的一方销毁本上下文
+    std::atomic_size_t refs{sizeof...(TTasks) + 1};
+
+    // 用于取消其余的协程，以及转发调用方的取消请求
+    unifex::inplace_stop_source stop_source;
+
+    struct ForwardStopRequest {
+      unifex::inplace_stop_source* stop_source;
+
+      void operator()() const noexcept
+      {
+        stop_source->request_stop();
+      }
+    };
+
+    std::optional<unifex::inplace_stop_callback<ForwardStopRequest>> upstream_stop;
+
+    void ForwardStop(const unifex::inplace_stop_token token)
+    {
+      if (token.stop_possible())
+        upstream_stop.emplace(token, ForwardStopRequest{&stop_source});
+    }
+
+    void Release(const std::size_t n = 1)
+    {
+      if (refs.fetch_sub(n, std::memory_order::acq_rel) == n)
+        delete this;
+    }
+
+    /**
+     * @return 是否是后到达的一方
+     */
+    bool Arrive()
+    {
+      return gate.fetch_sub(1, std::memory_order::acq_rel) == 1;
+    }
 
     [[nodiscard]] bool Done() const
     {
@@ -191,31 +270,44 @@ class any : std::tuple<TTasks&&...>
     }
 
     template <std::size_t I, class Ri>
-    void SetResultAndResume(Ri&& value, const bool is_inline)
+    void SetResultAndResume(Ri&& value)
     {
       result.emplace(MakeOfIdx<I>(std::forward<Ri>(value)));
 
-      if (not is_inline) {
-        if (original_executor.IsValid())
-          // TODO: 不用 ctx 接口
-          ctx::exe(original_executor).Post([h{continuation}]() {
-            h.resume();
-          });
-        else
-          continuation.resume();
-      } else
-        inline_resume = true;
+      // 取消其余仍在执行的协程。调用者与本协程各持有一份计数，期间本上下文不会被销毁
+      stop_source.request_stop();
+
+      // 调用者尚未完成挂起，由它原地继续执行
+      if (not Arrive())
+        return;
+
+      if (original_executor)
+        original_executor.Execute([h{continuation}]() {
+          h.resume();
+        });
+      else
+        continuation.resume();
     }
   };
 
+  struct ReleaseContext {
+    void operator()(Context* ctx) const
+    {
+      ctx->Release();
+    }
+  };
+
+  // 协程持有的一份上下文计数，随协程的结束（无论是否被取消）而释放
+  using Ref = std::unique_ptr<Context, ReleaseContext>;
+
   // 使用当前所在的执行器，在 any 被 resume 时继续所在协程的执行
-  res::Executor curr_exe_{core::details::g_thread_ctx.exe};
+  res::Executor curr_exe_{core::details::g_thread_ctx->exe};
 
   // any 等待的若干协程执行环境以及相关参数
   aimrt::co::AsyncScope* scope_{&GetGlobalScope()};
   res::Executor exe_{curr_exe_};
 
   // 这些协程以及 any 所在协程共同持有的一份上下文数据
-  std::shared_ptr<Context> ctx_;
+  Context* ctx_{nullptr};
 };
 }  // namespace aimrte::sync
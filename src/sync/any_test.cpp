@@ -3,7 +3,9 @@
 
 #include "./any.h"
 #include "src/test/test.h"
+#include <future>
 #include <string>
+#include <unifex/get_stop_token.hpp>
 
 namespace aimrte::test
 {
@@ -164,4 +166,118 @@ TEST_F(SyncAnyTest, UseExecutor)
   GTEST_ASSERT_EQ(value, 2);
 }
 
+TEST_F(SyncAnyTest, ResumeOnOriginalExecutor)
+{
+  std::atomic_int same_thread{0};
+
+  // 原本的执行器为单线程，协程在另一个执行器上结束，any 仍应在原本的执行器上继续执行
+  for (int i = 0; i < 10; ++i) {
+    thread_safe_exe.Post(
+      [&]() -> co::Task<void> {
+        const std::thread::id thread_id = std::this_thread::get_id();
+
+        co_await sync::any{
+          CoTaskWithSleep(1, 10),
+          CoTaskWithSleep(2, 20),
+        }
+          .Via(exe);
+
+        if (std::this_thread::get_id() == thread_id)
+          ++same_thread;
+      });
+  }
+
+  // 让所有协程执行完毕
+  ctrl.LetEnd();
+  GTEST_ASSERT_EQ(same_thread.load(), 10);
+}
+
+namespace
+{
+/**
+ * @brief 响应取消的协程，在收到停止请求之前一直运行，并通过 saw_stop 记录是否收到了停止请求
+ */
+co::Task<int> CoTaskUntilStopped(const int n, std::atomic_bool& saw_stop)
+{
+  struct OnStop {
+    std::atomic_bool* saw_stop;
+
+    void operator()() const noexcept
+    {
+      *saw_stop = true;
+    }
+  };
+
+  const co::StopToken token = co_await unifex::get_stop_token();
+  const unifex::inplace_stop_callback<OnStop> callback(token, OnStop{&saw_stop});
+
+  // 以 10s 为限，避免取消请求没有被转发时卡死测试
+  for (int i = 0; i < 1000 and not token.stop_requested(); ++i)
+    co_await ctx::Sleep(std::chrono::milliseconds(10));
+
+  co_return n;
+}
+}  // namespace
+
+TEST_F(SyncAnyTest, CancelLosers)
+{
+  std::atomic_bool saw_stop{false};
+  std::atomic_bool loser_handled{false};
+  std::size_t index = 1;
+
+  co::AsyncScope scope;
+  const auto start = std::chrono::steady_clock::now();
+
+  exe.Inline(
+    [&]() -> co::Task<void> {
+      auto result = co_await sync::any{
+        CoTaskWithSleep(1, 50),
+        CoTaskUntilStopped(2, saw_stop) | [&](int) {
+          loser_handled = true;
+        },
+      }
+                      .In(scope);
+
+      index = result.Index();
+    });
+
+  // 等待落败的协程响应取消后结束
+  scope.Complete();
+
+  GTEST_ASSERT_EQ(index, 0);
+  GTEST_ASSERT_TRUE(saw_stop.load());
+  GTEST_ASSERT_FALSE(loser_handled.load());
+  GTEST_ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
+
+TEST_F(SyncAnyTest, ForwardScopeCancel)
+{
+  std::atomic_bool saw_stop_1{false};
+  std::atomic_bool saw_stop_2{false};
+  std::promise<std::size_t> index;
+
+  co::AsyncScope scope;
+
+  // 两个协程都不会主动结束，只有 scope 的取消请求被转发给它们后，any 才能结束
+  exe.Post(
+    [&]() -> co::Task<void> {
+      auto result = co_await sync::any{
+        CoTaskUntilStopped(1, saw_stop_1),
+        CoTaskUntilStopped(2, saw_stop_2),
+      }
+                      .In(scope);
+
+      index.set_value(result.Index());
+    });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  const auto start = std::chrono::steady_clock::now();
+  scope.Cancel();
+
+  const std::size_t winner = index.get_future().get();
+  GTEST_ASSERT_LT(winner, 2);
+  GTEST_ASSERT_TRUE(saw_stop_1.load());
+  GTEST_ASSERT_TRUE(saw_stop_2.load());
+  GTEST_ASSERT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(5));
+}
 }  // namespace aimrte::test
@@ -5,18 +5,55 @@
 
 namespace aimrte::sync
 {
+Barrier::Barrier(const size_t count)
+    : thread_nums_(count), phase_(std::make_shared<Phase>(count))
+{
+}
+
+Barrier::~Barrier()
+{
+  phase_.load()->event.Finish(false);
+}
+
 void Barrier::Init()
 {
-  condition_.Init();
+  phase_.exchange(std::make_shared<Phase>(thread_nums_))->event.Finish(false);
+}
+
+co::Task<bool> Barrier::Arrive()
+{
+  const std::shared_ptr<Phase> phase = DoArrive();
+  if (phase == nullptr)
+    co_return true;
+
+  co_return co_await phase->event.Wait();
+}
+
+co::Task<bool> Barrier::Arrive(const std::chrono::steady_clock::duration timeout, const std::source_location loc)
+{
+  const std::shared_ptr<Phase> phase = DoArrive();
+  if (phase == nullptr)
+    co_return true;
+
+  co_return co_await phase->event.Wait(timeout, loc);
 }
 
 void Barrier::Wait()
 {
-  if (--count_ == 0) {
-    count_ = thread_nums_;
-    condition_.Satisfy();
-  } else {
-    condition_.Wait();
-  }
+  if (const std::shared_ptr<Phase> phase = DoArrive(); phase != nullptr)
+    phase->event.Wait().Sync();
+}
+
+std::shared_ptr<Barrier::Phase> Barrier::DoArrive()
+{
+  std::shared_ptr<Phase> phase = phase_.load(std::memory_order::acquire);
+
+  if (phase->remain.fetch_sub(1, std::memory_order::acq_rel) != 1)
+    return phase;
+
+  // 最后一个到达者：先开启新的一轮，再释放本轮的等待者，使被释放的参与者总能到达新的一轮
+  phase_.store(std::make_shared<Phase>(thread_nums_), std::memory_order::release);
+  phase->event.Finish(true);
+  return nullptr;
 }
 }  // namespace aimrte::sync
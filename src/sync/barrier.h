@@ -4,29 +4,69 @@
 #pragma once
 
 #include <atomic>
-#include "./condition.h"
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include "src/core/coroutine.h"
+#include "./details/event.h"
 
 namespace aimrte::sync
 {
 /**
- * @brief 用于多线程同步的barrier类，用计数方式进行判断。
+ * @brief 可重复使用的协程屏障，用计数方式进行判断：每一轮中，最后一个到达的参与者将释放本轮所有的等待者，
+ *        并开启新的一轮。Arrive() 挂起协程，而不阻塞执行器线程；Wait() 阻塞当前线程。
  */
 class Barrier
 {
  public:
-  explicit Barrier(size_t count) : thread_nums_(count), count_(count) {}
-  ~Barrier() { condition_.Fail(); }
+  explicit Barrier(size_t count);
+  ~Barrier();
 
   Barrier(Barrier const&)            = delete;
   Barrier& operator=(Barrier const&) = delete;
 
+  /**
+   * @brief 开启新的一轮，当前一轮中尚在等待的参与者将被释放，并返回 false
+   */
   void Init();
+
+  /**
+   * @brief 到达屏障，并等待本轮的所有参与者到达
+   * @return 本轮是否正常结束（为 false 时，表示本屏障被重新初始化或析构）
+   */
+  co::Task<bool> Arrive();
+
+  /**
+   * @brief 到达屏障，并限时地等待本轮的所有参与者到达，只能在执行器中使用。
+   * @return 本轮是否在超时之前正常结束
+   * @note 超时之后，本参与者的到达仍然被计入本轮。
+   */
+  co::Task<bool> Arrive(std::chrono::steady_clock::duration timeout, AIMRTE(src(loc)));
+
+  /**
+   * @brief 到达屏障，并阻塞当前线程，直到本轮的所有参与者到达
+   */
   void Wait();
 
  private:
-  Condition condition_;
+  // 一轮屏障
+  struct Phase {
+    explicit Phase(const size_t count) : remain(count) {}
+
+    std::atomic<size_t> remain;
+    details::Event event;
+  };
+
+  /**
+   * @brief 到达当前一轮
+   * @return 当前一轮；若本参与者是最后一个到达的，返回空指针
+   */
+  std::shared_ptr<Phase> DoArrive();
+
+ private:
+  const size_t thread_nums_;
 
-  size_t thread_nums_;
-  std::atomic<size_t> count_;
+  // 当前一轮，等待者持有其引用，直到被释放
+  std::atomic<std::shared_ptr<Phase>> phase_;
 };
 }  // namespace aimrte::sync
@@ -0,0 +1,227 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <cstddef>
+#include <optional>
+#include "src/core/coroutine.h"
+#include "./details/park_list.h"
+#include "./details/ring_buffer.h"
+
+namespace aimrte::sync
+{
+/**
+ * @brief 有界的无锁协程通道，用于在不同执行器上的协程之间传递数据。
+ *
+ * 数据存放在无锁的环形缓冲区中，收发不加锁；通道已满时 Send 挂起发送方，为空时 Recv 挂起接收方，
+ * 对方在取出（或放入）数据后唤醒它们。与 sync::any 相同，被挂起的协程会被投递回它原本所在的执行器上继续执行，
+ * 不在执行器中（如经由 Sync() 调用）时，则在唤醒者的线程上原地继续执行。
+ * 接收方只能有一个，同一时刻只能有一个 Recv 或 TryRecv 在进行；发送方的数量取决于 TRing 。
+ *
+ * @tparam T     数据类型
+ * @tparam TRing 环形缓冲区，见 details::SpscRing 与 details::MpscRing
+ */
+template <class T, class TRing>
+class BasicChannel
+{
+  struct ParkAwaiter;
+
+ public:
+  /**
+   * @param capacity 通道的容量，将被向上取整为 2 的幂
+   */
+  explicit BasicChannel(const std::size_t capacity)
+      : ring_(capacity)
+  {
+  }
+
+  BasicChannel(const BasicChannel&)            = delete;
+  BasicChannel& operator=(const BasicChannel&) = delete;
+
+  /**
+   * @return 通道的容量
+   */
+  [[nodiscard]] std::size_t Capacity() const
+  {
+    return ring_.Capacity();
+  }
+
+  /**
+   * @brief 尝试发送数据，不等待
+   * @return 是否成功，通道已满或已关闭时返回 false ，且不会移动给定的数据
+   */
+  template <class U>
+  bool TrySend(U&& value)
+  {
+    if (IsClosed() or not ring_.TryPush(std::forward<U>(value)))
+      return false;
+
+    WakeReceiver();
+    return true;
+  }
+
+  /**
+   * @brief 发送数据，通道已满时等待
+   * @return 是否成功，通道被关闭时返回 false
+   */
+  co::Task<bool> Send(T value)
+  {
+    while (true) {
+      if (IsClosed())
+        co_return false;
+
+      if (ring_.TryPush(std::move(value))) {
+        WakeReceiver();
+        co_return true;
+      }
+
+      ParkAwaiter awaiter{*this, senders_, &BasicChannel::SendReady};
+      co_await awaiter;
+    }
+  }
+
+  /**
+   * @brief 尝试接收数据，不等待
+   * @return 接收到的数据，通道为空时返回 std::nullopt
+   */
+  std::optional<T> TryRecv()
+  {
+    std::optional<T> value = ring_.TryPop();
+    if (value.has_value())
+      WakeSender();
+
+    return value;
+  }
+
+  /**
+   * @brief 接收数据，通道为空时等待
+   * @return 接收到的数据。通道被关闭、且其中的数据都已被取走时，返回 std::nullopt
+   */
+  co::Task<std::optional<T>> Recv()
+  {
+    while (true) {
+      if (std::optional<T> value = TryRecv(); value.has_value())
+        co_return value;
+
+      // 关闭之前发送的数据，可能在上一次检查之后才可见
+      if (IsClosed())
+        co_return TryRecv();
+
+      ParkAwaiter awaiter{*this, receivers_, &BasicChannel::RecvReady};
+      co_await awaiter;
+    }
+  }
+
+  /**
+   * @brief 关闭通道，唤醒所有正在等待的发送方与接收方。此后的发送都将失败，接收方仍可取走剩余的数据。
+   */
+  void Close()
+  {
+    closed_.store(true, std::memory_order::seq_cst);
+    senders_.Close();
+    receivers_.Close();
+  }
+
+  /**
+   * @return 通道是否已被关闭
+   */
+  [[nodiscard]] bool IsClosed() const
+  {
+    return closed_.load(std::memory_order::acquire);
+  }
+
+ private:
+  /**
+   * @brief 将调用者挂起到给定的列表上，挂起之后再次检查条件，避免与对方的唤醒错过
+   */
+  struct ParkAwaiter {
+    BasicChannel& channel;
+    details::ParkList& list;
+    bool (BasicChannel::*ready)() const;
+    details::Parked parked{};
+
+    static constexpr bool await_ready() { return false; }
+
+    bool await_suspend(const std::coroutine_handle<> continuation)
+    {
+      parked.handle = continuation;
+      parked.ctx    = core::details::g_thread_ctx;
+
+      // 压入之后，本协程随时可能被唤醒并结束，不能再访问自身，先取出需要的数据
+      BasicChannel& ch             = channel;
+      details::ParkList& park_list = list;
+      details::Parked* self        = &parked;
+      const auto is_ready          = ready;
+
+      // 列表已关闭
+      if (not park_list.Park(self))
+        return false;
+
+      // 与唤醒方的 “修改缓冲区、再检查挂起列表” 构成 Dekker 式的配对，
+      // 确保要么对方看到我们已挂起，要么我们看到对方的修改
+      std::atomic_thread_fence(std::memory_order::seq_cst);
+
+      if (not (ch.*is_ready)())
+        return true;
+
+      // 条件已经满足，由我们自己取出列表，若取到了自己，则无需挂起
+      return not park_list.WakeAll(self);
+    }
+
+    static constexpr void await_resume() {}
+  };
+
+  [[nodiscard]] bool SendReady() const
+  {
+    return ring_.CanPush() or IsClosed();
+  }
+
+  [[nodiscard]] bool RecvReady() const
+  {
+    return ring_.CanPop() or IsClosed();
+  }
+
+  void WakeReceiver()
+  {
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    if (receivers_.HasParked())
+      receivers_.WakeAll();
+  }
+
+  void WakeSender()
+  {
+    std::atomic_thread_fence(std::memory_order::seq_cst);
+    if (senders_.HasParked())
+      senders_.WakeAll();
+  }
+
+ private:
+  TRing ring_;
+  std::atomic_bool closed_{false};
+
+  // 等待空位的发送方与等待数据的接收方
+  details::ParkList senders_;
+  details::ParkList receivers_;
+};
+
+/**
+ * @brief 单生产者、单消费者的协程通道
+ */
+template <class T>
+using SpscChannel = BasicChannel<T, details::SpscRing<T>>;
+
+/**
+ * @brief 多生产者、单消费者的协程通道
+ */
+template <class T>
+using MpscChannel = BasicChannel<T, details::MpscRing<T>>;
+
+/**
+ * @brief 默认的协程通道，允许多个发送方
+ */
+template <class T>
+using Channel = MpscChannel<T>;
+}  // namespace aimrte::sync
@@ -0,0 +1,151 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./test/common.h"
+#include "src/sync/sync.h"
+#include <string>
+
+namespace aimrte::test
+{
+TEST_F(SyncTest, ChannelTrySendRecv)
+{
+  sync::SpscChannel<std::string> channel(3);
+  GTEST_ASSERT_EQ(channel.Capacity(), 4);
+
+  std::string value = "x";
+  for (int i = 0; i < 4; ++i)
+    GTEST_ASSERT_TRUE(channel.TrySend(value));
+
+  // 已满时发送失败，且不会移动给定的数据
+  GTEST_ASSERT_FALSE(channel.TrySend(std::move(value)));
+  GTEST_ASSERT_EQ(value, "x");
+
+  GTEST_ASSERT_EQ(channel.TryRecv(), "x");
+  GTEST_ASSERT_TRUE(channel.TrySend(value));
+
+  // 关闭后发送失败，但仍可取走剩余的数据
+  channel.Close();
+  GTEST_ASSERT_FALSE(channel.TrySend(value));
+  GTEST_ASSERT_FALSE(channel.Send(value).Sync());
+
+  int count = 0;
+  while (channel.Recv().Sync().has_value())
+    ++count;
+
+  GTEST_ASSERT_EQ(count, 4);
+  GTEST_ASSERT_FALSE(channel.TryRecv().has_value());
+}
+
+template <class TChannel>
+void SyncChannelTransfer(SyncTest& test, const int producers, const std::size_t capacity)
+{
+  constexpr int kCount = 20000;
+
+  TChannel channel(capacity);
+  std::vector<std::thread> threads;
+
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&channel, p]() {
+      for (int i = 0; i < kCount; ++i)
+        GTEST_ASSERT_TRUE(channel.Send(p * kCount + i).Sync());
+    });
+  }
+
+  std::atomic_int64_t sum   = 0;
+  std::atomic_int received  = 0;
+  std::atomic_bool in_order = true;
+  std::atomic_bool same_exe = true;
+
+  // 单线程的执行器，以便检查接收方被唤醒后是否回到了该执行器上
+  test.thread_safe_exe.Post(
+    [&]() -> co::Task<void> {
+      const std::thread::id thread_id = std::this_thread::get_id();
+      std::vector<int> last(producers, -1);
+
+      while (true) {
+        const std::optional<int> value = co_await channel.Recv();
+        if (not value.has_value())
+          co_return;
+
+        // 被唤醒后，应当回到本协程所在的执行器上继续执行
+        if (std::this_thread::get_id() != thread_id)
+          same_exe = false;
+
+        // 同一个生产者发送的数据，应当按发送的顺序被接收
+        const int producer = *value / kCount;
+        if (*value <= last[producer])
+          in_order = false;
+
+        last[producer] = *value;
+        sum += *value;
+        received.fetch_add(1);
+      }
+    });
+
+  for (std::thread& t : threads)
+    t.join();
+
+  channel.Close();
+
+  // 让所有协程执行完毕
+  test.ctrl.LetEnd();
+
+  const std::int64_t n = static_cast<std::int64_t>(producers) * kCount;
+  GTEST_ASSERT_EQ(received.load(), n);
+  GTEST_ASSERT_EQ(sum.load(), n * (n - 1) / 2);
+  GTEST_ASSERT_TRUE(in_order.load());
+  GTEST_ASSERT_TRUE(same_exe.load());
+}
+
+TEST_F(SyncTest, SpscChannelTransfer)
+{
+  SyncChannelTransfer<sync::SpscChannel<int>>(*this, 1, 2);
+}
+
+TEST_F(SyncTest, MpscChannelTransfer)
+{
+  SyncChannelTransfer<sync::MpscChannel<int>>(*this, 4, 16);
+}
+
+TEST_F(SyncTest, ChannelCloseWakesWaiters)
+{
+  sync::Channel<int> channel(2);
+  std::atomic_int woken = 0;
+
+  // 接收方等待数据
+  exe.Post(
+    [&]() -> co::Task<void> {
+      const std::optional<int> value = co_await channel.Recv();
+      if (not value.has_value())
+        woken.fetch_add(1);
+    });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  GTEST_ASSERT_EQ(woken.load(), 0);
+
+  channel.Close();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  GTEST_ASSERT_EQ(woken.load(), 1);
+
+  // 发送方等待空位
+  sync::Channel<int> full(2);
+  GTEST_ASSERT_TRUE(full.TrySend(1));
+  GTEST_ASSERT_TRUE(full.TrySend(2));
+
+  for (int i = 0; i < 3; ++i) {
+    exe.Post(
+      [&]() -> co::Task<void> {
+        const bool sent = co_await full.Send(3);
+        if (not sent)
+          woken.fetch_add(1);
+      });
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  GTEST_ASSERT_EQ(woken.load(), 1);
+
+  full.Close();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  GTEST_ASSERT_EQ(woken.load(), 4);
+}
+}  // namespace aimrte::test
@@ -6,7 +6,7 @@
 namespace aimrte::sync
 {
 Condition::Condition(bool value)
-    : value_(value)
+    : event_(value ? details::Event::Status::Succeeded : details::Event::Status::Pending)
 {
 }
 
@@ -17,41 +17,42 @@ Condition::~Condition()
 
 void Condition::Init(bool value)
 {
-  std::unique_lock lock(mutex_);
-  value_  = value;
-  failed_ = false;
+  if (value)
+    event_.Finish(true);
+  else
+    event_.Reset();
 }
 
 bool Condition::Wait() const
 {
-  std::unique_lock lock(mutex_);
+  if (const details::Event::Status status = event_.GetStatus(); status != details::Event::Status::Pending)
+    return status == details::Event::Status::Succeeded;
 
-  while (not failed_ and not value_) {
-    condition_.wait(lock);
-  }
+  return event_.Wait().Sync();
+}
 
-  return value_;
+co::Task<bool> Condition::WaitAsync() const
+{
+  return event_.Wait();
+}
+
+co::Task<bool> Condition::WaitAsync(const std::chrono::steady_clock::duration timeout, const std::source_location loc) const
+{
+  return event_.Wait(timeout, loc);
 }
 
 void Condition::Satisfy()
 {
-  std::unique_lock lock(mutex_);
-  value_  = true;
-  failed_ = false;
-  condition_.notify_all();
+  event_.Finish(true);
 }
 
 void Condition::Fail()
 {
-  std::unique_lock lock(mutex_);
-  value_  = false;
-  failed_ = true;
-  condition_.notify_all();
+  event_.Finish(false);
 }
 
 Condition::operator bool() const
 {
-  std::unique_lock lock(mutex_);
-  return value_;
+  return event_.GetStatus() == details::Event::Status::Succeeded;
 }
 }  // namespace aimrte::sync
@@ -3,14 +3,15 @@
 
 #pragma once
 
-#include <condition_variable>
-#include <mutex>
+#include <chrono>
+#include "src/core/coroutine.h"
+#include "./details/event.h"
 
 namespace aimrte::sync
 {
 /**
- * @brief 用于多线程同步的布尔条件类，对 mutex 与 condition_variable 的方便封装
- * @todo 改成同时支持协程的操作，类似 core::details::Sleeper，但让操作子本身是 awaiter
+ * @brief 用于同步的布尔条件类。Wait() 阻塞地等待条件成立；在协程中，使用 WaitAsync() 挂起协程，
+ *        而不阻塞执行器线程。
  */
 class Condition
 {
@@ -23,17 +24,29 @@ class Condition
   ~Condition();
 
   /**
-   * @brief 设置当前条件的值；但是，即使设置为 true，也不会释放其它正在等待条件满足的线程。
+   * @brief 设置当前条件的值；设置为 false 时不影响正在等待的协程，设置为 true 时，将释放它们。
    * @param value
    */
   void Init(bool value = false);
 
   /**
-   * @brief 等待条件成立。
+   * @brief 阻塞当前线程，等待条件成立。
    * @return 条件是否被满足；返回 false 只有一种可能：条件被标识为永远无法被满足（也即调用了 fail() 函数）。
    */
   bool Wait() const;
 
+  /**
+   * @brief 等待条件成立，挂起协程而不阻塞线程。
+   * @return 同 Wait()
+   */
+  co::Task<bool> WaitAsync() const;
+
+  /**
+   * @brief 限时地等待条件成立，只能在执行器中使用。
+   * @return 条件是否在超时之前被满足
+   */
+  co::Task<bool> WaitAsync(std::chrono::steady_clock::duration timeout, AIMRTE(src(loc))) const;
+
   /**
    * @brief 使条件满足，将释放所有正在等待条件满足的线程。
    */
@@ -50,10 +63,6 @@ class Condition
   operator bool() const;  // NOLINT(google-explicit-constructor)
 
  private:
-  mutable std::condition_variable condition_;
-  mutable std::mutex mutex_;
-
-  bool value_  = false;  // 标识本条件的成立状态
-  bool failed_ = false;  // 标识本条件是否无法被满足
+  mutable details::Event event_;
 };
 }  // namespace aimrte::sync
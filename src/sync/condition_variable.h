@@ -4,8 +4,14 @@
 #pragma once
 
 #include "src/core/coroutine.h"
+#include <chrono>
+#include <concepts>
 #include <memory>
+#include <optional>
 
+#include "src/core/cancel_token.h"
+#include "src/macro/macro.h"
+#include "./details/timed_wait.h"
 #include "./mutex.h"
 
 namespace aimrte::sync
@@ -24,7 +30,12 @@ class ConditionVariable
     static constexpr void await_resume() {}
   };
 
+  // 限时或可取消的等待体
+  struct TimedAwaiter;
+
  public:
+  ConditionVariable() = default;
+
   /**
    * @brief 开始等待本 cv 信号
    * @param lock 已经上锁的锁对象
@@ -37,8 +48,38 @@ class ConditionVariable
    * @param lock 已经上锁的锁对象
    */
   template <class FPred>
+    requires std::invocable<FPred&>
   co::Task<void> Wait(std::unique_lock<TMutex>& lock, FPred&& func);
 
+  /**
+   * @brief 开始等待本 cv 信号，直到信号到来，或取消令牌被取消。无论结果如何，返回时都已重新上锁
+   * @param lock 已经上锁的锁对象
+   * @return 是否因信号到来而结束等待
+   */
+  co::Task<bool> Wait(std::unique_lock<TMutex>& lock, core::CancelToken token);
+
+  /**
+   * @brief 在前置条件不成立的情况下，等待本 cv 信号，直到条件成立，或取消令牌被取消
+   * @return 条件是否成立
+   */
+  template <class FPred>
+  co::Task<bool> Wait(std::unique_lock<TMutex>& lock, FPred&& func, core::CancelToken token);
+
+  /**
+   * @brief 限时地等待本 cv 信号，只能在执行器中使用。无论结果如何，返回时都已重新上锁
+   * @param lock    已经上锁的锁对象
+   * @param timeout 超时时间
+   * @return 是否在超时之前收到信号
+   */
+  co::Task<bool> WaitFor(std::unique_lock<TMutex>& lock, std::chrono::steady_clock::duration timeout, AIMRTE(src(loc)));
+
+  /**
+   * @brief 在前置条件不成立的情况下，限时地等待本 cv 信号，信号到来时条件仍然不满足，将在剩余的时间内继续等待
+   * @return 条件是否成立
+   */
+  template <class FPred>
+  co::Task<bool> WaitFor(std::unique_lock<TMutex>& lock, std::chrono::steady_clock::duration timeout, FPred&& func, AIMRTE(src(loc)));
+
   /**
    * @brief 尝试唤醒一个等待者
    */
@@ -49,11 +90,41 @@ class ConditionVariable
    */
   void NotifyAll();
 
+  /**
+   * @return 队列中限时或可取消的等待者的数量，包括已经超时或被取消、尚未被清理的等待者
+   */
+  [[nodiscard]] std::size_t TimedWaiterCount() const;
+
  private:
   void Notify(bool all);
 
+  /**
+   * @brief 将 awaiter 压入等待信号的队列
+   */
+  void Push(Awaiter* awaiter);
+
+  /**
+   * @brief 限时或可取消的等待的实现。开始等待之前就已超时或被取消时，不会解锁；否则返回时已重新上锁
+   */
+  co::Task<bool> WaitWith(
+    std::unique_lock<TMutex>& lock,
+    std::optional<std::chrono::steady_clock::duration> timeout,
+    std::optional<core::CancelToken> token,
+    std::source_location loc);
+
+  /**
+   * @brief 唤醒一个限时或可取消的等待者，已经超时或被取消的等待者将被跳过
+   * @return 是否唤醒了等待者
+   */
+  bool NotifyOneTimed();
+
  private:
+  // 无限期等待信号的 awaiter 的 LIFO 队列
   std::atomic<Awaiter*> awaiter_{nullptr};
+
+  // 限时或可取消的等待者。已经超时或被取消的等待者在被通知时跳过，或在加入新的等待者时被批量清理，
+  // 因此即使一直没有通知，它们占用的内存也是有界的
+  details::TimedWaitList timed_;
 };
 }  // namespace aimrte::sync
 
@@ -66,14 +137,46 @@ void ConditionVariable<TMutex>::Awaiter::await_suspend(std::coroutine_handle<> c
 
   // 用于解锁
   std::unique_lock lock(mutex, std::adopt_lock);
-
-  // 将本 awaiter 压入队列中，同时，还要记住原本在队列头的 awaiter，
-  // 本函数可能会和 notify 流程并发
-  next_ = cv.awaiter_.load(std::memory_order::relaxed);
-  while (not cv.awaiter_.compare_exchange_weak(next_, this, std::memory_order::acquire, std::memory_order::relaxed))
-    ;
+  cv.Push(this);
 }
 
+template <class TMutex>
+struct ConditionVariable<TMutex>::TimedAwaiter {
+  ConditionVariable& cv;
+  TMutex& mutex;
+  std::optional<std::chrono::steady_clock::duration> timeout;
+  res::Executor exe;
+  std::optional<core::CancelToken> token;
+  std::source_location loc;
+
+  // 等待者的全部状态，须比等待者的协程帧活得更久
+  std::shared_ptr<details::TimedWait> wait;
+
+  static constexpr bool await_ready() { return false; }
+
+  bool await_suspend(std::coroutine_handle<> continuation)
+  {
+    wait->handle = continuation;
+    wait->self   = wait;
+
+    cv.timed_.Push(wait.get());
+    details::TimedWait::Watch(wait, timeout, std::move(exe), token, loc);
+
+    // 解锁之后，其他用户即可发出通知，但在 Arm() 之前，本协程不会被其他线程恢复
+    mutex.unlock();
+    return wait->Arm();
+  }
+
+  bool await_resume() const
+  {
+    if (token.has_value())
+      token->Unregister(wait.get());
+
+    wait->Disarm();
+    return wait->result == details::TimedWait::Result::Ok;
+  }
+};
+
 template <class TMutex>
 co::Task<void> ConditionVariable<TMutex>::Wait(std::unique_lock<TMutex>& lock)
 {
@@ -83,6 +186,7 @@ co::Task<void> ConditionVariable<TMutex>::Wait(std::unique_lock<TMutex>& lock)
 
 template <class TMutex>
 template <class FPred>
+  requires std::invocable<FPred&>
 co::Task<void> ConditionVariable<TMutex>::Wait(std::unique_lock<TMutex>& lock, FPred&& func)
 {
   while (not func()) {
@@ -90,6 +194,52 @@ co::Task<void> ConditionVariable<TMutex>::Wait(std::unique_lock<TMutex>& lock, F
   }
 }
 
+template <class TMutex>
+co::Task<bool> ConditionVariable<TMutex>::Wait(std::unique_lock<TMutex>& lock, core::CancelToken token)
+{
+  return WaitWith(lock, std::nullopt, std::move(token), std::source_location::current());
+}
+
+template <class TMutex>
+template <class FPred>
+co::Task<bool> ConditionVariable<TMutex>::Wait(std::unique_lock<TMutex>& lock, FPred&& func, core::CancelToken token)
+{
+  while (not func()) {
+    const bool notified = co_await Wait(lock, token);
+    if (not notified)
+      co_return static_cast<bool>(func());
+  }
+
+  co_return true;
+}
+
+template <class TMutex>
+co::Task<bool> ConditionVariable<TMutex>::WaitFor(
+  std::unique_lock<TMutex>& lock, const std::chrono::steady_clock::duration timeout, const std::source_location loc)
+{
+  return WaitWith(lock, timeout, std::nullopt, loc);
+}
+
+template <class TMutex>
+template <class FPred>
+co::Task<bool> ConditionVariable<TMutex>::WaitFor(
+  std::unique_lock<TMutex>& lock, const std::chrono::steady_clock::duration timeout, FPred&& func, const std::source_location loc)
+{
+  const std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::now() + timeout;
+
+  while (not func()) {
+    const std::chrono::steady_clock::duration remain = deadline - std::chrono::steady_clock::now();
+    if (remain <= std::chrono::steady_clock::duration::zero())
+      co_return false;
+
+    const bool notified = co_await WaitFor(lock, remain, loc);
+    if (not notified)
+      co_return static_cast<bool>(func());
+  }
+
+  co_return true;
+}
+
 template <class TMutex>
 void ConditionVariable<TMutex>::NotifyOne()
 {
@@ -102,6 +252,22 @@ void ConditionVariable<TMutex>::NotifyAll()
   Notify(true);
 }
 
+template <class TMutex>
+std::size_t ConditionVariable<TMutex>::TimedWaiterCount() const
+{
+  return timed_.Size();
+}
+
+template <class TMutex>
+void ConditionVariable<TMutex>::Push(Awaiter* awaiter)
+{
+  // 将 awaiter 压入队列中，同时，还要记住原本在队列头的 awaiter，
+  // 本函数可能会和 notify 流程并发
+  awaiter->next_ = awaiter_.load(std::memory_order::relaxed);
+  while (not awaiter_.compare_exchange_weak(awaiter->next_, awaiter, std::memory_order::acq_rel, std::memory_order::relaxed))
+    ;
+}
+
 template <class TMutex>
 void ConditionVariable<TMutex>::Notify(const bool all)
 {
@@ -110,16 +276,71 @@ void ConditionVariable<TMutex>::Notify(const bool all)
 
   do {
     if (head == nullptr)
-      return;
-  } while (not awaiter_.compare_exchange_weak(head, all ? nullptr : head->next_, std::memory_order::release, std::memory_order::relaxed));
+      break;
+  } while (not awaiter_.compare_exchange_weak(head, all ? nullptr : head->next_, std::memory_order::acq_rel, std::memory_order::relaxed));
 
-  // 唤醒 awaiter
-  if (not all)
-    head->next_ = nullptr;
+  if (not all) {
+    // 优先唤醒无限期的等待者，没有时，再唤醒限时或可取消的等待者
+    if (head != nullptr)
+      head->continuation_.resume();
+    else
+      NotifyOneTimed();
 
-  do {
+    return;
+  }
+
+  // 唤醒所有的 awaiter，被唤醒的 awaiter 随时可能结束，须先取出下一个
+  while (head != nullptr) {
+    Awaiter* next = head->next_;
     head->continuation_.resume();
-    head = head->next_;
-  } while (head != nullptr);
+    head = next;
+  }
+
+  if (timed_.Size() != 0) {
+    timed_.Drain([](details::TimedWait* wait) {
+      wait->Notify();
+    });
+  }
+}
+
+template <class TMutex>
+bool ConditionVariable<TMutex>::NotifyOneTimed()
+{
+  while (timed_.Size() != 0) {
+    details::TimedWait* wait = timed_.Pop();
+    if (wait == nullptr)
+      return false;
+
+    // 若它已经超时或被取消，则将通知交给下一个
+    if (wait->Notify())
+      return true;
+  }
+
+  return false;
+}
+
+template <class TMutex>
+co::Task<bool> ConditionVariable<TMutex>::WaitWith(
+  std::unique_lock<TMutex>& lock,
+  const std::optional<std::chrono::steady_clock::duration> timeout,
+  const std::optional<core::CancelToken> token,
+  const std::source_location loc)
+{
+  // 以下提前返回的情况中，没有解锁过
+  if (token.has_value() and token->IsCancelled())
+    co_return false;
+
+  res::Executor exe;
+  if (timeout.has_value()) {
+    if (*timeout <= std::chrono::steady_clock::duration::zero())
+      co_return false;
+
+    exe = details::TimerExecutor(loc);
+  }
+
+  TimedAwaiter awaiter{*this, *lock.mutex(), timeout, std::move(exe), token, loc, std::make_shared<details::TimedWait>()};
+  const bool ok = co_await awaiter;
+  co_await lock.mutex()->Lock();
+  co_return ok;
 }
 }  // namespace aimrte::sync
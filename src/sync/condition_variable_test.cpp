@@ -40,4 +40,106 @@ TEST_F(SyncTest, CVLockAndNotify)
 {
   SyncCVLockAndNotify<sync::ConditionVariable, sync::SpinMutex>(*this);
 }
+
+TEST_F(SyncTest, CVWaitFor)
+{
+  sync::Mutex mutex;
+  sync::ConditionVariable<sync::Mutex> cv;
+  bool flag = false;
+  std::atomic_int timeout  = 0;
+  std::atomic_int notified = 0;
+
+  exe.Post(
+    [&]() -> co::Task<void> {
+      std::unique_lock lock = co_await mutex.ScopedLock();
+
+      // 超时返回时，也已重新上锁
+      if (not co_await cv.WaitFor(lock, std::chrono::milliseconds(20)) and lock.owns_lock())
+        timeout.fetch_add(1);
+    });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  GTEST_ASSERT_EQ(timeout.load(), 1);
+
+  exe.Post(
+    [&]() -> co::Task<void> {
+      std::unique_lock lock = co_await mutex.ScopedLock();
+
+      if (co_await cv.WaitFor(lock, std::chrono::seconds(1), [&]() { return flag; }))
+        notified.fetch_add(1);
+    });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+  // 通知将跳过已经超时的等待者，交给仍在等待的一方
+  mutex.lock();
+  flag = true;
+  mutex.unlock();
+  cv.NotifyOne();
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  GTEST_ASSERT_EQ(notified.load(), 1);
+}
+
+TEST_F(SyncTest, CVWaitCancel)
+{
+  sync::Mutex mutex;
+  sync::ConditionVariable<sync::Mutex> cv;
+  core::CancelToken token;
+  std::atomic_int cancelled = 0;
+
+  for (int i = 0; i < 10; ++i) {
+    exe.Post(
+      [&]() -> co::Task<void> {
+        std::unique_lock lock = co_await mutex.ScopedLock();
+
+        if (not co_await cv.Wait(lock, []() { return false; }, token))
+          cancelled.fetch_add(1);
+      });
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  GTEST_ASSERT_EQ(cancelled.load(), 0);
+
+  token.Cancel();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  GTEST_ASSERT_EQ(cancelled.load(), 10);
+  GTEST_ASSERT_TRUE(mutex.TryLock());
+  mutex.Unlock();
+}
+
+TEST_F(SyncTest, CVWaitForTimeoutsStayBounded)
+{
+  constexpr int kWaiters = 4;
+  constexpr int kRounds  = 500;
+
+  sync::Mutex mutex;
+  sync::ConditionVariable<sync::Mutex> cv;
+  std::atomic_int timeout         = 0;
+  std::atomic_size_t max_in_queue = 0;
+
+  // 反复超时、且一直没有通知，已经超时的等待者应被及时清理，而不是一直留在队列中
+  for (int n = 0; n < kWaiters; ++n) {
+    exe.Post(
+      [&]() -> co::Task<void> {
+        std::unique_lock lock = co_await mutex.ScopedLock();
+
+        for (int i = 0; i < kRounds; ++i) {
+          const bool notified = co_await cv.WaitFor(lock, std::chrono::microseconds(200));
+          if (not notified)
+            timeout.fetch_add(1);
+
+          std::size_t curr = max_in_queue.load();
+          while (curr < cv.TimedWaiterCount() and not max_in_queue.compare_exchange_weak(curr, cv.TimedWaiterCount()))
+            ;
+        }
+      });
+  }
+
+  // 让所有协程执行完毕
+  ctrl.LetEnd();
+
+  GTEST_ASSERT_EQ(timeout.load(), kWaiters * kRounds);
+  GTEST_ASSERT_LE(max_in_queue.load(), 64);
+}
 }  // namespace aimrte::test
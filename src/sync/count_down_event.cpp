@@ -2,8 +2,40 @@
 // All rights reserved.
 
 #include "./count_down_event.h"
+#include <algorithm>
 
 namespace aimrte::sync
 {
+CountDownEvent::CountDownEvent(const int value)
+    : count_(value), event_(value <= 0 ? details::Event::Status::Succeeded : details::Event::Status::Pending)
+{
+}
+
+void CountDownEvent::CountDown(const int n)
+{
+  // 仅由使计数越过 0 的一方触发事件
+  const int old_count = count_.fetch_sub(n, std::memory_order::acq_rel);
+  if (old_count > 0 and old_count - n <= 0)
+    event_.Finish(true);
+}
+
+co::Task<bool> CountDownEvent::Wait()
+{
+  return event_.Wait();
+}
 
+co::Task<bool> CountDownEvent::Wait(const std::chrono::steady_clock::duration timeout, const std::source_location loc)
+{
+  return event_.Wait(timeout, loc);
+}
+
+bool CountDownEvent::IsSet() const
+{
+  return event_.GetStatus() == details::Event::Status::Succeeded;
+}
+
+int CountDownEvent::Count() const
+{
+  return std::max(count_.load(std::memory_order::relaxed), 0);
 }
+}  // namespace aimrte::sync
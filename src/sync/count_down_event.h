@@ -4,20 +4,56 @@
 #pragma once
 
 #include <atomic>
-
-#include "./condition_variable.h"
-#include "./mutex.h"
+#include <chrono>
+#include "src/core/coroutine.h"
+#include "./details/event.h"
 
 namespace aimrte::sync
 {
+/**
+ * @brief 倒数事件：计数减为 0 时事件发生，释放所有的等待者，此后的等待将立即返回。
+ *        等待时挂起协程，而不阻塞执行器线程；在普通线程上，可以通过 Wait().Sync() 同步地等待。
+ */
 class CountDownEvent
 {
  public:
+  /**
+   * @param value 初始计数，不大于 0 时，事件立即发生
+   */
   explicit CountDownEvent(int value);
 
+  CountDownEvent(const CountDownEvent&)            = delete;
+  CountDownEvent& operator=(const CountDownEvent&) = delete;
+
+  /**
+   * @brief 将计数减少 n ，计数因此减为 0 时，事件发生
+   */
+  void CountDown(int n = 1);
+
+  /**
+   * @brief 等待事件发生
+   * @return 事件是否发生（为 false 时，表示本对象被析构）
+   */
+  co::Task<bool> Wait();
+
+  /**
+   * @brief 限时地等待事件发生，只能在执行器中使用。
+   * @return 事件是否在超时之前发生
+   */
+  co::Task<bool> Wait(std::chrono::steady_clock::duration timeout, AIMRTE(src(loc)));
+
+  /**
+   * @return 事件是否已经发生
+   */
+  [[nodiscard]] bool IsSet() const;
+
+  /**
+   * @return 当前的计数
+   */
+  [[nodiscard]] int Count() const;
+
  private:
-  Mutex mutex_;
-  ConditionVariable<Mutex> cv_;
-  int count_{0};
+  std::atomic_int count_{0};
+  details::Event event_;
 };
 }  // namespace aimrte::sync
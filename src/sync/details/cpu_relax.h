@@ -0,0 +1,19 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+namespace aimrte::sync::details
+{
+/**
+ * @brief 提示 CPU 当前处于自旋等待中，以降低功耗、并让出超线程的执行资源
+ */
+inline void CpuRelax()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_ia32_pause();
+#elif defined(__aarch64__)
+  asm volatile("yield" ::: "memory");
+#endif
+}
+}  // namespace aimrte::sync::details
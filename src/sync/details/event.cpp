@@ -0,0 +1,207 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./event.h"
+#include "./timed_wait.h"
+#include "src/ctx/ctx.h"
+
+namespace aimrte::sync::details
+{
+struct Event::Awaiter {
+  Event& event;
+  EventWaiter waiter{};
+  std::optional<bool> result{};
+
+  bool await_ready()
+  {
+    if (const Status status = event.GetStatus(); status != Status::Pending)
+      result = status == Status::Succeeded;
+
+    return result.has_value();
+  }
+
+  bool await_suspend(const std::coroutine_handle<> continuation)
+  {
+    waiter.handle = continuation;
+
+    // 压入之后，本协程随时可能被唤醒并结束，不能再访问自身
+    if (const Status status = event.Push(&waiter); status != Status::Pending) {
+      result = status == Status::Succeeded;
+      return false;
+    }
+
+    return true;
+  }
+
+  bool await_resume() const
+  {
+    return result.has_value() ? *result : waiter.ok;
+  }
+};
+
+struct Event::TimedAwaiter {
+  // 限时的等待者，由等待者、事件与超时计时共同持有
+  struct Waiter : TimedWait {
+    // 被事件唤醒时，事件是否成功
+    bool ok = false;
+  };
+
+  Event& event;
+  std::shared_ptr<Waiter> waiter;
+  std::chrono::steady_clock::duration timeout;
+  res::Executor exe;
+  std::source_location loc;
+  std::optional<bool> result{};
+
+  static constexpr bool await_ready() { return false; }
+
+  bool await_suspend(const std::coroutine_handle<> continuation)
+  {
+    waiter->handle = continuation;
+    waiter->self   = waiter;
+
+    // 在持有链表锁的情况下检查事件状态，与 Finish() 中先改变状态、再取出链表的顺序配合，不会遗漏等待者
+    Status status = Status::Pending;
+
+    const bool pushed = event.timed_.PushIf(
+      waiter.get(),
+      [&]() {
+        status = event.GetStatus();
+        return status == Status::Pending;
+      });
+
+    if (not pushed) {
+      waiter->self.reset();
+      result = status == Status::Succeeded;
+      return false;
+    }
+
+    // 在 Arm() 之前，本协程不会被其他线程恢复，可以继续访问自身
+    TimedWait::Watch(waiter, timeout, std::move(exe), std::nullopt, loc);
+    return waiter->Arm();
+  }
+
+  bool await_resume() const
+  {
+    if (result.has_value())
+      return *result;
+
+    waiter->Disarm();
+    return waiter->result == TimedWait::Result::Ok and waiter->ok;
+  }
+};
+
+Event::Event(const Status status)
+    : state_(nullptr)
+{
+  if (status != Status::Pending)
+    state_.store(Tag(status), std::memory_order::relaxed);
+}
+
+Event::~Event()
+{
+  // 释放仍在等待的等待者，避免它们的协程永远无法结束
+  Finish(false);
+}
+
+Event::Status Event::GetStatus() const
+{
+  return StatusOf(state_.load(std::memory_order::acquire));
+}
+
+void Event::Finish(const bool ok)
+{
+  // 取出所有的等待者，使用 acq_rel ，与等待者的压入形成 happen-before 关系
+  void* old_state = state_.exchange(Tag(ok ? Status::Succeeded : Status::Failed), std::memory_order::acq_rel);
+  if (StatusOf(old_state) != Status::Pending)
+    return;
+
+  // 等待者在本线程上被原地恢复，会将它们的上下文写入本线程，结束时须恢复本线程原有的上下文
+  const core::details::ThreadContext outer_ctx = core::details::g_thread_ctx;
+  AIMRTE(defer(core::details::SwitchThreadContext(outer_ctx)));
+
+  // 将 LIFO 链表翻转为 FIFO 队列
+  EventWaiter* next = nullptr;
+  EventWaiter* curr = static_cast<EventWaiter*>(old_state);
+
+  while (curr != nullptr) {
+    EventWaiter* next_curr = curr->next;
+    curr->next             = next;
+
+    next = curr;
+    curr = next_curr;
+  }
+
+  // 依次唤醒。等待者被唤醒后可能随即被释放，须先取出下一个
+  while (next != nullptr) {
+    EventWaiter* waiter = next;
+    next                = waiter->next;
+
+    waiter->ok = ok;
+    waiter->handle.resume();
+  }
+
+  // 限时的等待者中，已经超时的将被跳过
+  timed_.Drain([ok](TimedWait* wait) {
+    static_cast<TimedAwaiter::Waiter*>(wait)->ok = ok;
+    wait->Notify();
+  });
+}
+
+void Event::Reset()
+{
+  void* old_state = state_.load(std::memory_order::relaxed);
+
+  while (StatusOf(old_state) != Status::Pending) {
+    if (state_.compare_exchange_weak(old_state, nullptr, std::memory_order::relaxed))
+      return;
+  }
+}
+
+co::Task<bool> Event::Wait()
+{
+  co_return co_await Awaiter{*this};
+}
+
+co::Task<bool> Event::Wait(const std::chrono::steady_clock::duration timeout, const std::source_location loc)
+{
+  if (const Status status = GetStatus(); status != Status::Pending)
+    co_return status == Status::Succeeded;
+
+  if (timeout <= std::chrono::steady_clock::duration::zero())
+    co_return false;
+
+  TimedAwaiter awaiter{*this, std::make_shared<TimedAwaiter::Waiter>(), timeout, TimerExecutor(loc), loc};
+  co_return co_await awaiter;
+}
+
+Event::Status Event::Push(EventWaiter* waiter)
+{
+  void* old_state = state_.load(std::memory_order::acquire);
+
+  do {
+    if (const Status status = StatusOf(old_state); status != Status::Pending)
+      return status;
+
+    waiter->next = static_cast<EventWaiter*>(old_state);
+  } while (not state_.compare_exchange_weak(old_state, waiter, std::memory_order::release, std::memory_order::acquire));
+
+  return Status::Pending;
+}
+
+void* Event::Tag(const Status status) const
+{
+  return const_cast<char*>(status == Status::Succeeded ? &succeeded_tag_ : &failed_tag_);
+}
+
+Event::Status Event::StatusOf(void* state) const
+{
+  if (state == Tag(Status::Succeeded))
+    return Status::Succeeded;
+
+  if (state == Tag(Status::Failed))
+    return Status::Failed;
+
+  return Status::Pending;
+}
+}  // namespace aimrte::sync::details
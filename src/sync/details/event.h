@@ -0,0 +1,106 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <memory>
+#include <optional>
+#include <source_location>
+#include "src/core/coroutine.h"
+#include "src/macro/macro.h"
+#include "./timed_wait.h"
+
+namespace aimrte::sync::details
+{
+/**
+ * @brief 事件的无限期等待者，位于等待者的协程帧中
+ */
+struct EventWaiter {
+  EventWaiter* next = nullptr;
+  std::coroutine_handle<> handle;
+
+  // 被唤醒的原因：事件成功发生为 true ，事件失败为 false
+  bool ok = false;
+};
+
+/**
+ * @brief 无锁的一次性事件，是 Condition、Barrier 与 CountDownEvent 的共同基础。
+ *
+ * 与 v2::Mutex 相同，使用单个原子指针表示全部状态：事件未发生时，它是无限期等待者的 LIFO 链表（可为空）；
+ * 事件发生后，它是代表成功或失败的标记值。限时的等待者基于 TimedWait ，另外放在由互斥锁保护的 TimedWaitList 中，
+ * 超时的等待者会在之后加入新的等待者时被清理。事件发生时，一次性取出两个链表，分别按到来的顺序唤醒其中所有的等待者，
+ * 被唤醒的协程将在触发事件的线程上继续执行。
+ */
+class Event
+{
+ public:
+  enum class Status {
+    Pending,
+    Succeeded,
+    Failed,
+  };
+
+  explicit Event(Status status = Status::Pending);
+  ~Event();
+
+  Event(const Event&)            = delete;
+  Event& operator=(const Event&) = delete;
+
+  /**
+   * @return 事件当前的状态
+   */
+  [[nodiscard]] Status GetStatus() const;
+
+  /**
+   * @brief 使事件发生，并唤醒所有的等待者。事件已经发生时，仅改变其结果
+   * @param ok 事件是否成功
+   */
+  void Finish(bool ok);
+
+  /**
+   * @brief 将已经发生的事件重置为未发生；事件未发生时，不影响已有的等待者
+   */
+  void Reset();
+
+  /**
+   * @brief 等待事件发生
+   * @return 事件是否成功
+   */
+  co::Task<bool> Wait();
+
+  /**
+   * @brief 限时地等待事件发生。超时计时在当前执行器上进行，因此只能在执行器中使用；执行器启用了时间轮时，计时挂在时间轮上，事件先于超时发生时即被撤销。
+   * @return 事件是否在超时之前成功发生
+   */
+  co::Task<bool> Wait(std::chrono::steady_clock::duration timeout, AIMRTE(src(loc)));
+
+ private:
+  /**
+   * @brief 尝试将等待者压入链表
+   * @return 压入成功时返回 Pending ，否则返回事件已经发生的结果
+   */
+  Status Push(EventWaiter* waiter);
+
+  [[nodiscard]] void* Tag(Status status) const;
+  [[nodiscard]] Status StatusOf(void* state) const;
+
+  // 无限期的等待体，等待者位于协程帧中
+  struct Awaiter;
+
+  // 限时的等待体，等待者由多方共同持有
+  struct TimedAwaiter;
+
+ private:
+  std::atomic<void*> state_;
+
+  // 限时的等待者，仅在事件未发生时加入，事件发生时全部取出
+  TimedWaitList timed_;
+
+  // 代表事件成功与失败的标记值，取这两个成员的地址
+  char succeeded_tag_{};
+  char failed_tag_{};
+};
+}  // namespace aimrte::sync::details
@@ -0,0 +1,97 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./park_list.h"
+#include "src/core/core.h"
+
+namespace aimrte::sync::details
+{
+bool ParkList::Park(Parked* parked)
+{
+  void* old_state = state_.load(std::memory_order::relaxed);
+
+  do {
+    if (old_state == ClosedState())
+      return false;
+
+    parked->next = static_cast<Parked*>(old_state);
+  } while (not state_.compare_exchange_weak(old_state, parked, std::memory_order::seq_cst, std::memory_order::relaxed));
+
+  return true;
+}
+
+bool ParkList::HasParked() const
+{
+  void* state = state_.load(std::memory_order::relaxed);
+  return state != nullptr and state != ClosedState();
+}
+
+bool ParkList::WakeAll(const Parked* self)
+{
+  void* old_state = state_.load(std::memory_order::relaxed);
+
+  do {
+    if (old_state == nullptr or old_state == ClosedState())
+      return false;
+  } while (not state_.compare_exchange_weak(old_state, nullptr, std::memory_order::acquire, std::memory_order::relaxed));
+
+  return WakeList(static_cast<Parked*>(old_state), self);
+}
+
+void ParkList::Close()
+{
+  void* old_state = state_.exchange(ClosedState(), std::memory_order::acq_rel);
+  if (old_state != ClosedState())
+    WakeList(static_cast<Parked*>(old_state), nullptr);
+}
+
+bool ParkList::WakeList(Parked* head, const Parked* self)
+{
+  // 将 LIFO 链表翻转为 FIFO 队列
+  Parked* next = nullptr;
+
+  while (head != nullptr) {
+    Parked* next_head = head->next;
+    head->next        = next;
+
+    next = head;
+    head = next_head;
+  }
+
+  // 依次唤醒。挂起者被唤醒后可能随即结束，须先取出下一个
+  bool found = false;
+
+  while (next != nullptr) {
+    Parked* parked = next;
+    next           = parked->next;
+
+    if (parked == self)
+      found = true;
+    else
+      Wake(parked);
+  }
+
+  return found;
+}
+
+void ParkList::Wake(Parked* parked)
+{
+  const std::coroutine_handle<> handle   = parked->handle;
+  const core::details::ThreadContext ctx = std::move(parked->ctx);
+
+  // 与 sync::any 相同，投递回挂起者原本的执行器上继续执行
+  if (ctx->exe.IsValid()) {
+    if (const std::shared_ptr<core::Context> ctx_ptr = ctx->ctx_ptr.lock(); ctx_ptr != nullptr) {
+      ctx_ptr->exe(ctx->exe).Post([handle]() { handle.resume(); });
+      return;
+    }
+  }
+
+  handle.resume();
+}
+
+void* ParkList::ClosedState() const
+{
+  return const_cast<ParkList*>(this);
+}
+}  // namespace aimrte::sync::details
@@ -0,0 +1,75 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include "src/core/details/thread_context.h"
+
+namespace aimrte::sync::details
+{
+/**
+ * @brief 挂起在 ParkList 上的协程，位于该协程的帧中
+ */
+struct Parked {
+  Parked* next = nullptr;
+  std::coroutine_handle<> handle;
+
+  // 挂起时的上下文，用于在其原本的执行器上唤醒它
+  core::details::ThreadContext ctx;
+};
+
+/**
+ * @brief 无锁的挂起列表，供 Channel 的发送方与接收方等待对方。
+ *
+ * 与 v2::Mutex 相同，使用单个原子指针表示全部状态：它是挂起者的 LIFO 链表（可为空），或代表已关闭的标记值。
+ * 唤醒时一次性取出整个链表，按挂起的顺序唤醒所有的挂起者，由它们各自重新检查条件。
+ * 挂起者若在挂起时处于执行器中，将被投递回该执行器继续执行，否则在唤醒者的线程上原地继续执行。
+ */
+class ParkList
+{
+ public:
+  ParkList() = default;
+
+  ParkList(const ParkList&)            = delete;
+  ParkList& operator=(const ParkList&) = delete;
+
+  /**
+   * @brief 将挂起者压入链表
+   * @return 是否成功，列表已关闭时返回 false
+   */
+  bool Park(Parked* parked);
+
+  /**
+   * @return 是否可能有挂起者，用于在唤醒之前避免不必要的原子写
+   */
+  [[nodiscard]] bool HasParked() const;
+
+  /**
+   * @brief 唤醒当前所有的挂起者
+   * @param self 调用者自己的挂起者，若它也被取出，则不唤醒它
+   * @return self 是否被本次调用取出；为 true 时，调用者应当直接继续执行，而非等待被唤醒
+   */
+  bool WakeAll(const Parked* self = nullptr);
+
+  /**
+   * @brief 关闭本列表，并唤醒所有的挂起者，此后的 Park 都将失败
+   */
+  void Close();
+
+ private:
+  /**
+   * @brief 唤醒给定 LIFO 链表中除 self 以外的挂起者
+   * @return self 是否在链表中
+   */
+  static bool WakeList(Parked* head, const Parked* self);
+
+  static void Wake(Parked* parked);
+
+  [[nodiscard]] void* ClosedState() const;
+
+ private:
+  std::atomic<void*> state_{nullptr};
+};
+}  // namespace aimrte::sync::details
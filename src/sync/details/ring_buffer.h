@@ -0,0 +1,227 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <utility>
+
+namespace aimrte::sync::details
+{
+// 生产者与消费者各自频繁修改的下标分处不同的缓存行，避免伪共享
+inline constexpr std::size_t kCacheLineSize = 64;
+
+/**
+ * @brief 容量向上取整为 2 的幂，以便使用掩码取下标
+ */
+inline std::size_t RingCapacity(const std::size_t capacity)
+{
+  return std::bit_ceil(capacity < 2 ? std::size_t{2} : capacity);
+}
+
+/**
+ * @brief 有界的单生产者、单消费者无锁环形缓冲区。
+ *
+ * 双方各自缓存对方的下标，仅在缓存的下标显示已满（或已空）时才重新读取对方的下标，
+ * 因此在稳定的流水线中，每次操作只有一次对自身下标的 release 写。
+ */
+template <class T>
+class SpscRing
+{
+ public:
+  explicit SpscRing(const std::size_t capacity)
+      : mask_(RingCapacity(capacity) - 1), slots_(std::make_unique<std::optional<T>[]>(mask_ + 1))
+  {
+  }
+
+  SpscRing(const SpscRing&)            = delete;
+  SpscRing& operator=(const SpscRing&) = delete;
+
+  [[nodiscard]] std::size_t Capacity() const
+  {
+    return mask_ + 1;
+  }
+
+  /**
+   * @brief 放入数据，仅可由生产者调用
+   * @return 是否成功，已满时返回 false ，且不会移动给定的数据
+   */
+  template <class U>
+  bool TryPush(U&& value)
+  {
+    const std::size_t tail = tail_.load(std::memory_order::relaxed);
+
+    if (tail - cached_head_ > mask_) {
+      cached_head_ = head_.load(std::memory_order::acquire);
+      if (tail - cached_head_ > mask_)
+        return false;
+    }
+
+    slots_[tail & mask_].emplace(std::forward<U>(value));
+    tail_.store(tail + 1, std::memory_order::release);
+    return true;
+  }
+
+  /**
+   * @brief 取出数据，仅可由消费者调用
+   * @return 取出的数据，为空时返回 std::nullopt
+   */
+  std::optional<T> TryPop()
+  {
+    const std::size_t head = head_.load(std::memory_order::relaxed);
+
+    if (head == cached_tail_) {
+      cached_tail_ = tail_.load(std::memory_order::acquire);
+      if (head == cached_tail_)
+        return std::nullopt;
+    }
+
+    std::optional<T>& slot = slots_[head & mask_];
+    std::optional<T> value = std::move(slot);
+    slot.reset();
+
+    head_.store(head + 1, std::memory_order::release);
+    return value;
+  }
+
+  /**
+   * @return 当前是否有空位，可由任意线程调用
+   */
+  [[nodiscard]] bool CanPush() const
+  {
+    return tail_.load(std::memory_order::acquire) - head_.load(std::memory_order::acquire) <= mask_;
+  }
+
+  /**
+   * @return 当前是否有数据，可由任意线程调用
+   */
+  [[nodiscard]] bool CanPop() const
+  {
+    return head_.load(std::memory_order::acquire) != tail_.load(std::memory_order::acquire);
+  }
+
+ private:
+  const std::size_t mask_;
+  const std::unique_ptr<std::optional<T>[]> slots_;
+
+  // 消费者的下标，以及它缓存的生产者下标
+  alignas(kCacheLineSize) std::atomic<std::size_t> head_{0};
+  std::size_t cached_tail_{0};
+
+  // 生产者的下标，以及它缓存的消费者下标
+  alignas(kCacheLineSize) std::atomic<std::size_t> tail_{0};
+  std::size_t cached_head_{0};
+};
+
+/**
+ * @brief 有界的多生产者、单消费者无锁环形缓冲区。
+ *
+ * 每个槽位带有一个序号，表示它当前可被第几次写入或读取（Vyukov 的有界队列）：
+ * 生产者通过 CAS 抢占写入的下标，写入数据后发布序号；唯一的消费者按序号判断数据是否已经写完。
+ */
+template <class T>
+class MpscRing
+{
+  struct Cell {
+    std::atomic<std::size_t> seq;
+    std::optional<T> value;
+  };
+
+ public:
+  explicit MpscRing(const std::size_t capacity)
+      : mask_(RingCapacity(capacity) - 1), cells_(std::make_unique<Cell[]>(mask_ + 1))
+  {
+    for (std::size_t i = 0; i <= mask_; ++i)
+      cells_[i].seq.store(i, std::memory_order::relaxed);
+  }
+
+  MpscRing(const MpscRing&)            = delete;
+  MpscRing& operator=(const MpscRing&) = delete;
+
+  [[nodiscard]] std::size_t Capacity() const
+  {
+    return mask_ + 1;
+  }
+
+  /**
+   * @brief 放入数据，可由任意线程调用
+   * @return 是否成功，已满时返回 false ，且不会移动给定的数据
+   */
+  template <class U>
+  bool TryPush(U&& value)
+  {
+    std::size_t pos = enqueue_pos_.load(std::memory_order::relaxed);
+
+    while (true) {
+      Cell& cell               = cells_[pos & mask_];
+      const std::size_t seq    = cell.seq.load(std::memory_order::acquire);
+      const std::ptrdiff_t dif = static_cast<std::ptrdiff_t>(seq - pos);
+
+      if (dif == 0) {
+        // 槽位空闲，抢占该下标；失败时 pos 被更新为最新的下标
+        if (enqueue_pos_.compare_exchange_weak(pos, pos + 1, std::memory_order::relaxed)) {
+          cell.value.emplace(std::forward<U>(value));
+          cell.seq.store(pos + 1, std::memory_order::release);
+          return true;
+        }
+      } else if (dif < 0) {
+        // 槽位的上一轮数据尚未被取走，已满
+        return false;
+      } else {
+        pos = enqueue_pos_.load(std::memory_order::relaxed);
+      }
+    }
+  }
+
+  /**
+   * @brief 取出数据，仅可由消费者调用
+   * @return 取出的数据，为空（或下一个数据尚未写完）时返回 std::nullopt
+   */
+  std::optional<T> TryPop()
+  {
+    const std::size_t pos = dequeue_pos_.load(std::memory_order::relaxed);
+    Cell& cell            = cells_[pos & mask_];
+
+    if (cell.seq.load(std::memory_order::acquire) != pos + 1)
+      return std::nullopt;
+
+    std::optional<T> value = std::move(cell.value);
+    cell.value.reset();
+
+    dequeue_pos_.store(pos + 1, std::memory_order::relaxed);
+
+    // 释放该槽位，供下一轮写入
+    cell.seq.store(pos + mask_ + 1, std::memory_order::release);
+    return value;
+  }
+
+  /**
+   * @return 当前是否有空位，可由任意线程调用
+   */
+  [[nodiscard]] bool CanPush() const
+  {
+    const std::size_t pos = enqueue_pos_.load(std::memory_order::acquire);
+    return static_cast<std::ptrdiff_t>(cells_[pos & mask_].seq.load(std::memory_order::acquire) - pos) >= 0;
+  }
+
+  /**
+   * @return 当前是否有已写完的数据，可由任意线程调用
+   */
+  [[nodiscard]] bool CanPop() const
+  {
+    const std::size_t pos = dequeue_pos_.load(std::memory_order::acquire);
+    return cells_[pos & mask_].seq.load(std::memory_order::acquire) == pos + 1;
+  }
+
+ private:
+  const std::size_t mask_;
+  const std::unique_ptr<Cell[]> cells_;
+
+  alignas(kCacheLineSize) std::atomic<std::size_t> enqueue_pos_{0};
+  alignas(kCacheLineSize) std::atomic<std::size_t> dequeue_pos_{0};
+};
+}  // namespace aimrte::sync::details
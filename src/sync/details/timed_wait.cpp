@@ -0,0 +1,198 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./timed_wait.h"
+#include <algorithm>
+#include "src/core/get_scheduler.h"
+#include "src/ctx/ctx.h"
+#include "src/panic/panic.h"
+
+namespace aimrte::sync::details
+{
+bool TimedWait::Claim()
+{
+  return not claimed_.exchange(true, std::memory_order::acq_rel);
+}
+
+bool TimedWait::Claimed() const
+{
+  return claimed_.load(std::memory_order::acquire);
+}
+
+void TimedWait::Release()
+{
+  // 使用 acq_rel ，确保等待者能看到设置的结果
+  if (gate_.fetch_sub(1, std::memory_order::acq_rel) == 1)
+    handle.resume();
+}
+
+bool TimedWait::Arm()
+{
+  return gate_.fetch_sub(1, std::memory_order::acq_rel) != 1;
+}
+
+bool TimedWait::Notify()
+{
+  // 等待者被唤醒后可能随即结束，由本函数保持本状态有效，直到返回
+  const std::shared_ptr<void> keep = std::move(self);
+
+  if (not Claim())
+    return false;
+
+  result = Result::Ok;
+  Release();
+  return true;
+}
+
+void TimedWait::Disarm()
+{
+  // 撤销失败时，计时已经到期，由到期的回调释放它持有的引用
+  if (wheel_ != nullptr and wheel_->Cancel(&timer_))
+    timer_self_.reset();
+}
+
+void TimedWait::Expire(const Result expired)
+{
+  result = expired;
+  Release();
+}
+
+void TimedWait::OnTimer(core::details::TimerWheel::Node* node)
+{
+  const std::shared_ptr<TimedWait> wait = std::move(static_cast<TimerNode*>(node)->wait->timer_self_);
+
+  if (wait->Claim())
+    wait->Expire(Result::Timeout);
+}
+
+void TimedWait::Watch(
+  const std::shared_ptr<TimedWait>& wait,
+  const std::optional<std::chrono::steady_clock::duration> timeout,
+  res::Executor exe,
+  const std::optional<core::CancelToken>& token,
+  const std::source_location& loc)
+{
+  if (token.has_value()) {
+    const bool registered = token->Register(
+      wait.get(),
+      [wait]() {
+        if (wait->Claim())
+          wait->Expire(Result::Cancelled);
+      });
+
+    // 令牌已在此前被取消，由本线程代为认领
+    if (not registered and wait->Claim()) {
+      wait->Expire(Result::Cancelled);
+      return;
+    }
+  }
+
+  if (not timeout.has_value())
+    return;
+
+  // 优先挂到执行器的时间轮上，等待成功后可以撤销
+  if (core::details::TimerWheel* wheel = core::details::GetTimerWheel(exe, loc); wheel != nullptr) {
+    wait->wheel_          = wheel;
+    wait->timer_self_     = wait;
+    wait->timer_.wait     = wait.get();
+    wait->timer_.callback = &TimedWait::OnTimer;
+    wheel->Schedule(&wait->timer_, *timeout);
+    return;
+  }
+
+  // 否则在执行器上申请一次定时任务，到期时若仍未被唤醒，则以超时唤醒
+  const std::chrono::nanoseconds duration = std::chrono::duration_cast<std::chrono::nanoseconds>(*timeout);
+
+  core::details::GetExecutor(exe, loc)
+    .ExecuteAfter(
+      duration,
+      [weak_wait = std::weak_ptr<TimedWait>(wait)]() {
+        if (const std::shared_ptr<TimedWait> strong_wait = weak_wait.lock(); strong_wait != nullptr and strong_wait->Claim())
+          strong_wait->Expire(Result::Timeout);
+      });
+}
+
+void TimedWaitList::Push(TimedWait* wait)
+{
+  TimedWait* dead = nullptr;
+
+  {
+    const std::lock_guard lock(mutex_);
+    dead = Append(wait);
+  }
+
+  Free(dead);
+}
+
+TimedWait* TimedWaitList::Pop()
+{
+  const std::lock_guard lock(mutex_);
+
+  TimedWait* wait = head_;
+  if (wait == nullptr)
+    return nullptr;
+
+  head_ = std::exchange(wait->next_, nullptr);
+  if (head_ == nullptr)
+    tail_ = nullptr;
+
+  size_.fetch_sub(1, std::memory_order::relaxed);
+  return wait;
+}
+
+std::size_t TimedWaitList::Size() const
+{
+  return size_.load(std::memory_order::acquire);
+}
+
+TimedWait* TimedWaitList::Append(TimedWait* wait)
+{
+  TimedWait* dead  = nullptr;
+  std::size_t size = size_.load(std::memory_order::relaxed);
+
+  // 清理已被超时计时或取消回调认领的等待者，它们不会再被通知，只是在等待链表释放它们
+  if (size >= sweep_at_) {
+    TimedWait** link = &head_;
+    tail_            = nullptr;
+
+    while (TimedWait* curr = *link) {
+      if (curr->Claimed()) {
+        *link       = curr->next_;
+        curr->next_ = dead;
+        dead        = curr;
+        --size;
+      } else {
+        tail_ = curr;
+        link  = &curr->next_;
+      }
+    }
+
+    sweep_at_ = std::max(size * 2, kMinSweep);
+  }
+
+  wait->next_                               = nullptr;
+  (tail_ != nullptr ? tail_->next_ : head_) = wait;
+  tail_                                     = wait;
+
+  size_.store(size + 1, std::memory_order::release);
+  return dead;
+}
+
+void TimedWaitList::Free(TimedWait* dead)
+{
+  while (dead != nullptr) {
+    TimedWait* next = dead->next_;
+    dead->self.reset();
+    dead = next;
+  }
+}
+
+res::Executor TimerExecutor(const std::source_location& loc)
+{
+  res::Executor exe = core::details::g_thread_ctx->exe;
+  if (not exe.IsValid())
+    panic(loc).wtf("Never wait with timeout outside of aimrte::ctx::Executor !");
+
+  return exe;
+}
+}  // namespace aimrte::sync::details
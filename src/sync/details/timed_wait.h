@@ -0,0 +1,246 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <coroutine>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <source_location>
+#include <utility>
+#include "src/core/cancel_token.h"
+#include "src/core/coroutine.h"
+#include "src/core/timer_wheel.h"
+#include "src/res/res.h"
+
+namespace aimrte::sync::details
+{
+class TimedWaitList;
+
+/**
+ * @brief 限时或可取消的等待的共享状态，由等待队列、超时计时与取消回调共同持有。
+ *
+ * 唤醒方（等待队列的通知、超时计时、取消回调）中，仅有率先认领（Claim）成功的一方设置结果并唤醒等待者；
+ * 其余各方发现已被认领，即视为本等待已经从队列中移除，直接丢弃。
+ * 由于认领可能发生在等待者挂起的准备完成之前，唤醒与挂起的完成之间，通过一个计数为 2 的闸门会合：
+ * 后到的一方负责继续执行等待者，因此等待者在 await_suspend 返回之前，不会被其他线程恢复。
+ */
+struct TimedWait {
+  enum class Result {
+    Ok,
+    Timeout,
+    Cancelled,
+  };
+
+  std::coroutine_handle<> handle;
+
+  // 由认领成功的一方设置
+  Result result = Result::Ok;
+
+  // 位于等待队列中时，由队列持有的、包含本状态的对象，出队时释放
+  std::shared_ptr<void> self;
+
+  /**
+   * @return 是否认领成功，每个等待仅有一方可以成功
+   */
+  bool Claim();
+
+  /**
+   * @return 是否已被某一方认领，即已经超时、被取消或被通知
+   */
+  [[nodiscard]] bool Claimed() const;
+
+  /**
+   * @brief 认领成功的一方在设置结果后调用，若等待者已完成挂起，则唤醒它
+   */
+  void Release();
+
+  /**
+   * @brief 等待者在 await_suspend 的末尾调用
+   * @return 是否保持挂起；若已被认领并释放，则返回 false ，由等待者直接继续执行
+   */
+  bool Arm();
+
+  /**
+   * @brief 由等待队列在出队后调用：释放队列持有的引用，认领成功时以 Ok 唤醒等待者
+   * @return 是否认领成功；已经超时或被取消时返回 false
+   */
+  bool Notify();
+
+  /**
+   * @brief 等待者被唤醒后调用，撤销尚未到期的超时计时
+   */
+  void Disarm();
+
+  /**
+   * @brief 在等待者进入等待队列之后，启动超时计时与取消的监听。
+   *        执行器启用了时间轮时，计时挂在时间轮上，等待成功后可被撤销；否则向执行器申请一次定时任务，
+   *        它仅持有本状态的弱引用，不会延长等待者的生命周期。
+   * @param wait    等待的共享状态
+   * @param timeout 超时时间，为空时不计时
+   * @param exe     用于超时计时的执行器
+   * @param token   取消令牌，为空时不监听
+   * @param loc     发起等待的代码位置，用于执行器相关的错误报告
+   */
+  static void Watch(
+    const std::shared_ptr<TimedWait>& wait,
+    std::optional<std::chrono::steady_clock::duration> timeout,
+    res::Executor exe,
+    const std::optional<core::CancelToken>& token,
+    const std::source_location& loc);
+
+ private:
+  friend class TimedWaitList;
+
+  // 时间轮上的计时节点
+  struct TimerNode : core::details::TimerWheel::Node {
+    TimedWait* wait = nullptr;
+  };
+
+  /**
+   * @brief 超时计时或取消回调认领成功后调用，以给定的结果唤醒等待者
+   */
+  void Expire(Result expired);
+
+  static void OnTimer(core::details::TimerWheel::Node* node);
+
+ private:
+  std::atomic_bool claimed_{false};
+  std::atomic_int gate_{2};
+
+  // 位于 TimedWaitList 中时的下一个节点，由链表的锁保护
+  TimedWait* next_ = nullptr;
+
+  // 超时计时所在的时间轮，未使用时间轮计时时为空
+  core::details::TimerWheel* wheel_ = nullptr;
+  TimerNode timer_{};
+
+  // 时间轮上的计时持有的引用，在计时到期或被撤销时释放
+  std::shared_ptr<TimedWait> timer_self_;
+};
+
+/**
+ * @brief 限时或可取消的等待者的 FIFO 链表，由一把 std::mutex 保护，并非无锁的。
+ *
+ * 加入、取出与清理都在锁内完成，持锁的时间很短；PushIf 需要在锁内检查条件并加入，以便与通知方的
+ * 先改变状态、再取出链表的顺序配合，因此没有使用无锁的链表。无限期的等待者不经过本链表，不受该锁影响。
+ *
+ * 超时或被取消的等待者不会被唤醒方摘除（唤醒方无法得知链表的所有者是否仍然存在），而是在加入新的等待者时，
+ * 若链表的长度达到了上一次清理后的两倍，一并清理并释放。因此即使一直没有通知，链表的长度也至多为
+ * 仍在等待的数量的两倍（外加一个常数），清理的开销均摊到每次加入上为常数。
+ */
+class TimedWaitList
+{
+ public:
+  TimedWaitList() = default;
+
+  TimedWaitList(const TimedWaitList&)            = delete;
+  TimedWaitList& operator=(const TimedWaitList&) = delete;
+
+  /**
+   * @brief 在持有链表锁的情况下检查给定的条件，成立时将等待加入链表尾部，由链表持有 wait->self
+   * @return 是否加入了链表
+   */
+  template <class FCond>
+  bool PushIf(TimedWait* wait, FCond&& cond);
+
+  /**
+   * @brief 将等待加入链表尾部，由链表持有 wait->self
+   */
+  void Push(TimedWait* wait);
+
+  /**
+   * @brief 取出链表头部的等待，它的 wait->self 交由调用者处理
+   * @return 链表为空时返回空指针
+   */
+  TimedWait* Pop();
+
+  /**
+   * @brief 取出链表中的全部等待，在锁外按加入的顺序逐一交给给定的函数处理
+   */
+  template <class F>
+  void Drain(F&& func);
+
+  /**
+   * @return 链表中等待者的数量，包括已经超时或被取消、尚未被清理的等待者
+   */
+  [[nodiscard]] std::size_t Size() const;
+
+ private:
+  // 链表的长度达到该值时，才会在加入时清理
+  static constexpr std::size_t kMinSweep = 16;
+
+  /**
+   * @brief 加入链表尾部，必要时先清理已被认领的等待者。须持有锁
+   * @return 被清理的等待者持有的引用组成的链表，由调用者在锁外释放
+   */
+  TimedWait* Append(TimedWait* wait);
+
+  /**
+   * @brief 释放被清理的等待者
+   */
+  static void Free(TimedWait* dead);
+
+ private:
+  std::mutex mutex_;
+  TimedWait* head_ = nullptr;
+  TimedWait* tail_ = nullptr;
+
+  // 下一次清理时的链表长度
+  std::size_t sweep_at_ = kMinSweep;
+
+  // 在锁外读取，以便调用者在链表为空时跳过加锁
+  std::atomic_size_t size_{0};
+};
+
+/**
+ * @brief 在等待开始之前，取得超时计时所需的当前执行器，不在执行器中时终止程序
+ */
+res::Executor TimerExecutor(const std::source_location& loc);
+}  // namespace aimrte::sync::details
+
+namespace aimrte::sync::details
+{
+template <class FCond>
+bool TimedWaitList::PushIf(TimedWait* wait, FCond&& cond)
+{
+  TimedWait* dead = nullptr;
+
+  {
+    const std::lock_guard lock(mutex_);
+
+    if (not cond())
+      return false;
+
+    dead = Append(wait);
+  }
+
+  Free(dead);
+  return true;
+}
+
+template <class F>
+void TimedWaitList::Drain(F&& func)
+{
+  TimedWait* head = nullptr;
+
+  {
+    const std::lock_guard lock(mutex_);
+
+    head  = std::exchange(head_, nullptr);
+    tail_ = nullptr;
+    size_.store(0, std::memory_order::relaxed);
+  }
+
+  // 等待者被唤醒后可能随即被释放，须先取出下一个
+  while (head != nullptr) {
+    TimedWait* next = head->next_;
+    func(head);
+    head = next;
+  }
+}
+}  // namespace aimrte::sync::details
@@ -0,0 +1,13 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+namespace aimrte
+{
+/**
+ * @brief 无返回值的协程在 sync::any 与 sync::all 的结果中的占位类型
+ */
+struct Void {
+};
+}  // namespace aimrte
@@ -0,0 +1,177 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./test/common.h"
+#include "src/sync/sync.h"
+
+namespace aimrte::test
+{
+TEST_F(SyncTest, ConditionWaitInCoroutine)
+{
+  sync::Condition condition;
+  std::atomic_int satisfied = 0;
+
+  for (int i = 0; i < 100; ++i) {
+    exe.Post(
+      [&]() -> co::Task<void> {
+        if (co_await condition.WaitAsync())
+          satisfied.fetch_add(1);
+      });
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  GTEST_ASSERT_EQ(satisfied.load(), 0);
+
+  condition.Satisfy();
+  GTEST_ASSERT_EQ(satisfied.load(), 100);
+
+  // 条件满足后，等待立即返回
+  GTEST_ASSERT_TRUE(condition.Wait());
+
+  condition.Init(false);
+  GTEST_ASSERT_FALSE(condition);
+
+  condition.Fail();
+  GTEST_ASSERT_FALSE(condition.Wait());
+}
+
+TEST_F(SyncTest, ConditionWaitTimeout)
+{
+  sync::Condition condition;
+  std::atomic_int timeout = 0;
+  std::atomic_int done    = 0;
+
+  exe.Post(
+    [&]() -> co::Task<void> {
+      if (not co_await condition.WaitAsync(std::chrono::milliseconds(20)))
+        timeout.fetch_add(1);
+
+      // 超时之后，仍然可以再次等待
+      if (co_await condition.WaitAsync(std::chrono::seconds(1)))
+        done.fetch_add(1);
+    });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  GTEST_ASSERT_EQ(timeout.load(), 1);
+  GTEST_ASSERT_EQ(done.load(), 0);
+
+  condition.Satisfy();
+  GTEST_ASSERT_EQ(done.load(), 1);
+}
+
+TEST_F(SyncTest, ConditionSatisfyKeepsContext)
+{
+  sync::Condition condition;
+  std::atomic_bool resumed = false;
+
+  exe.Post(
+    [&]() -> co::Task<void> {
+      if (co_await condition.WaitAsync())
+        resumed = true;
+    });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+  // 等待者在本线程上被原地恢复，之后本线程的上下文应当保持不变
+  const core::details::ThreadContext before = core::details::g_thread_ctx;
+  condition.Satisfy();
+
+  GTEST_ASSERT_TRUE(resumed.load());
+  GTEST_ASSERT_TRUE(core::details::g_thread_ctx.SameAs(before));
+}
+
+TEST_F(SyncTest, BarrierArrive)
+{
+  constexpr int kParticipants = 4;
+  constexpr int kRounds       = 100;
+
+  sync::Barrier barrier(kParticipants);
+  std::atomic_int arrived = 0;
+  bool out_of_phase       = false;
+
+  for (int i = 0; i < kParticipants; ++i) {
+    exe.Post(
+      [&]() -> co::Task<void> {
+        for (int round = 0; round < kRounds; ++round) {
+          arrived.fetch_add(1);
+          co_await barrier.Arrive();
+
+          // 每一轮结束时，所有参与者都已到达
+          if (arrived.load() < (round + 1) * kParticipants)
+            out_of_phase = true;
+
+          co_await barrier.Arrive();
+        }
+      });
+  }
+
+  // 让所有协程执行完毕
+  ctrl.LetEnd();
+  GTEST_ASSERT_EQ(arrived.load(), kParticipants * kRounds);
+  GTEST_ASSERT_FALSE(out_of_phase);
+}
+
+TEST_F(SyncTest, BarrierArriveTimeout)
+{
+  sync::Barrier barrier(2);
+  std::atomic_int result = -1;
+
+  exe.Post(
+    [&]() -> co::Task<void> {
+      result = co_await barrier.Arrive(std::chrono::milliseconds(20)) ? 1 : 0;
+    });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  GTEST_ASSERT_EQ(result.load(), 0);
+
+  // 超时的参与者仍被计入本轮，第二个参与者到达时本轮结束
+  GTEST_ASSERT_TRUE(barrier.Arrive().Sync());
+}
+
+TEST_F(SyncTest, CountDownEvent)
+{
+  sync::CountDownEvent event(3);
+  std::atomic_int released = 0;
+
+  for (int i = 0; i < 10; ++i) {
+    exe.Post(
+      [&]() -> co::Task<void> {
+        if (co_await event.Wait())
+          released.fetch_add(1);
+      });
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+
+  event.CountDown();
+  event.CountDown();
+  GTEST_ASSERT_EQ(released.load(), 0);
+  GTEST_ASSERT_EQ(event.Count(), 1);
+  GTEST_ASSERT_FALSE(event.IsSet());
+
+  event.CountDown();
+  GTEST_ASSERT_EQ(released.load(), 10);
+  GTEST_ASSERT_TRUE(event.IsSet());
+
+  // 多余的倒数不会重复触发事件
+  event.CountDown();
+  GTEST_ASSERT_TRUE(event.Wait().Sync());
+}
+
+TEST_F(SyncTest, CountDownEventTimeout)
+{
+  sync::CountDownEvent event(1);
+  std::atomic_int result = -1;
+
+  exe.Post(
+    [&]() -> co::Task<void> {
+      result = co_await event.Wait(std::chrono::milliseconds(20)) ? 1 : 0;
+    });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  GTEST_ASSERT_EQ(result.load(), 0);
+
+  event.CountDown();
+  GTEST_ASSERT_TRUE(event.IsSet());
+}
+}  // namespace aimrte::test
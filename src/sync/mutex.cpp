@@ -40,6 +40,57 @@ bool Mutex::Awaiter::await_suspend(const std::coroutine_handle<> continuation)
   return mutex.LockAndSuspend(this);
 }
 
+struct Mutex::TimedAwaiter {
+  // 等待者的全部状态，须比等待者的协程帧活得更久
+  struct Node {
+    explicit Node(Mutex& mutex) : awaiter{mutex} {}
+
+    Awaiter awaiter;
+    details::TimedWait wait;
+  };
+
+  Mutex& mutex;
+  std::optional<std::chrono::steady_clock::duration> timeout;
+  res::Executor exe;
+  std::optional<core::CancelToken> token;
+  std::source_location loc;
+  std::shared_ptr<Node> node;
+
+  static constexpr bool await_ready() { return false; }
+
+  bool await_suspend(const std::coroutine_handle<> continuation)
+  {
+    node->wait.handle    = continuation;
+    node->wait.self      = node;
+    node->awaiter.timed_ = &node->wait;
+
+    // 在这一步中抢到了锁，它没有进入队列，无需挂起
+    if (not mutex.LockAndSuspend(&node->awaiter)) {
+      node->wait.self.reset();
+      return false;
+    }
+
+    // 在 Arm() 之前，本协程不会被其他线程恢复，可以继续访问自身
+    details::TimedWait::Watch({node, &node->wait}, timeout, std::move(exe), token, loc);
+    return node->wait.Arm();
+  }
+
+  bool await_resume() const
+  {
+    if (token.has_value())
+      token->Unregister(&node->wait);
+
+    node->wait.Disarm();
+
+    if (node->wait.result == details::TimedWait::Result::Ok)
+      return true;
+
+    // 放弃等待的 awaiter 仍留在队列中，直到被跳过或压缩
+    mutex.OnAbandoned();
+    return false;
+  }
+};
+
 Mutex::Mutex()
     : state_(UnlockedState())
 {
@@ -62,22 +113,41 @@ co::Task<std::unique_lock<Mutex>> Mutex::ScopedLock()
   co_return std::unique_lock(*this, std::adopt_lock);
 }
 
-void Mutex::Unlock()
+co::Task<bool> Mutex::TryLockFor(const std::chrono::steady_clock::duration timeout, const std::source_location loc)
 {
-  // 当前互斥量带锁，以下操作不会被并发。
-  // 若有 awaiter 在队列里等待，则保持互斥量上锁状态，直接唤醒它即可
-  if (awaiter_ != nullptr) {
-    Awaiter* awaiter_to_resume = awaiter_;
-    awaiter_                   = awaiter_->next_;
-    awaiter_to_resume->continuation_.resume();
-    return;
-  }
+  return LockWith(timeout, std::nullopt, loc);
+}
+
+co::Task<bool> Mutex::TryLockFor(const std::chrono::steady_clock::duration timeout, core::CancelToken token, const std::source_location loc)
+{
+  return LockWith(timeout, std::move(token), loc);
+}
 
-  // awaiter 队列为空，检查当前状态是否有被排队的 awaiter，
-  // 若有，则将它们压入队列并唤醒；
-  // 若没有，则解锁本互斥量。
-  // 访问 state_ 会与其他期望上锁的用户并发。
+co::Task<bool> Mutex::Lock(core::CancelToken token)
+{
+  return LockWith(std::nullopt, std::move(token), std::source_location::current());
+}
+
+void Mutex::Unlock()
+{
+  // 当前互斥量带锁，以下操作不会被并发
   while (true) {
+    // 若有 awaiter 在队列里等待，则保持互斥量上锁状态，直接唤醒它即可；
+    // 若它已经超时或被取消，则跳过它，尝试下一个
+    if (awaiter_ != nullptr) {
+      Awaiter* awaiter_to_resume = awaiter_;
+      awaiter_                   = awaiter_->next_;
+
+      if (Resume(awaiter_to_resume))
+        return;
+
+      continue;
+    }
+
+    // awaiter 队列为空，检查当前状态是否有被排队的 awaiter，
+    // 若有，则将它们压入队列，再逐一尝试唤醒；
+    // 若没有，则解锁本互斥量。
+    // 访问 state_ 会与其他期望上锁的用户并发。
     void* old_value = state_.load(std::memory_order::relaxed);
 
     // 若只有当前用户持有本互斥量，则尝试解锁
@@ -92,31 +162,26 @@ void Mutex::Unlock()
     // 使用 acquire，确保后边锁域内的读写不会被重排上来
     assert(old_value != UnlockedState());
     old_value = state_.exchange(nullptr, std::memory_order::acquire);
+    assert(old_value != UnlockedState());
 
-    assert(old_value != UnlockedState() and old_value != nullptr);
-    awaiter_ = static_cast<Awaiter*>(old_value);
+    // 排队的 awaiter 已被 Compact() 取下，由它在之后放回，重新检查即可
+    if (old_value == nullptr)
+      continue;
 
-    // 取出排队中的 awaiter，准备对其进行操作
-    break;
-  }
+    // 在 state_ 中的 awaiter 形成了 LIFO 队列，我们将其翻转为 FIFO 队列
+    Awaiter* next = nullptr;
+    Awaiter* curr = static_cast<Awaiter*>(old_value);
 
-  // 在 state_ 中的 awaiter 形成了 LIFO 队列，我们将其翻转为 FIFO 队列
-  assert(awaiter_ != nullptr);
-  Awaiter* next = nullptr;
-  Awaiter* curr = awaiter_;
-
-  do {
-    Awaiter* next_curr = curr->next_;
-    curr->next_        = next;
+    do {
+      Awaiter* next_curr = curr->next_;
+      curr->next_        = next;
 
-    next = curr;
-    curr = next_curr;
-  } while (curr != nullptr);
+      next = curr;
+      curr = next_curr;
+    } while (curr != nullptr);
 
-  // 弹出并唤醒第一个 awaiter
-  assert(next != nullptr);
-  awaiter_ = next->next_;
-  next->continuation_.resume();
+    awaiter_ = next;
+  }
 }
 
 bool Mutex::LockAndSuspend(Awaiter* awaiter)
@@ -141,6 +206,105 @@ bool Mutex::LockAndSuspend(Awaiter* awaiter)
   }
 }
 
+co::Task<bool> Mutex::LockWith(
+  const std::optional<std::chrono::steady_clock::duration> timeout,
+  const std::optional<core::CancelToken> token,
+  const std::source_location loc)
+{
+  if (TryLock())
+    co_return true;
+
+  if (token.has_value() and token->IsCancelled())
+    co_return false;
+
+  res::Executor exe;
+  if (timeout.has_value()) {
+    if (*timeout <= std::chrono::steady_clock::duration::zero())
+      co_return false;
+
+    exe = details::TimerExecutor(loc);
+  }
+
+  TimedAwaiter awaiter{*this, timeout, std::move(exe), token, loc, std::make_shared<TimedAwaiter::Node>(*this)};
+  co_return co_await awaiter;
+}
+
+bool Mutex::Resume(Awaiter* awaiter)
+{
+  if (awaiter->timed_ == nullptr) {
+    awaiter->continuation_.resume();
+    return true;
+  }
+
+  // 出队时释放队列持有的引用，若它已经超时或被取消，则随之释放
+  return awaiter->timed_->Notify();
+}
+
+void Mutex::OnAbandoned()
+{
+  if (abandoned_.fetch_add(1, std::memory_order::relaxed) + 1 < kCompactThreshold)
+    return;
+
+  if (compacting_.exchange(true, std::memory_order::acquire))
+    return;
+
+  abandoned_.store(0, std::memory_order::relaxed);
+  Compact();
+  compacting_.store(false, std::memory_order::release);
+}
+
+void Mutex::Compact()
+{
+  // 取下排队的 awaiter ，state_ 随之变为“已上锁、无人排队”
+  void* old_state = state_.load(std::memory_order::relaxed);
+
+  do {
+    if (old_state == UnlockedState() or old_state == nullptr)
+      return;
+  } while (not state_.compare_exchange_weak(old_state, nullptr, std::memory_order::acquire, std::memory_order::relaxed));
+
+  // 摘除已被认领的 awaiter ，其余的保持原有的顺序。在 state_ 中的限时 awaiter 只可能被超时计时或取消回调认领
+  Awaiter* head  = nullptr;
+  Awaiter* tail  = nullptr;
+  Awaiter** link = &head;
+
+  for (Awaiter* curr = static_cast<Awaiter*>(old_state); curr != nullptr;) {
+    Awaiter* next = curr->next_;
+
+    if (curr->timed_ != nullptr and curr->timed_->Claimed()) {
+      // 释放队列持有的引用，awaiter 可能随之被释放
+      curr->timed_->self.reset();
+    } else {
+      *link = curr;
+      tail  = curr;
+      link  = &curr->next_;
+    }
+
+    curr = next;
+  }
+
+  *link = nullptr;
+  if (head == nullptr)
+    return;
+
+  // 将其余的 awaiter 放回。取下期间，持锁的用户可能已经解锁，此时由本用户代为加锁，并通过 Unlock() 唤醒它们
+  void* curr_state = state_.load(std::memory_order::relaxed);
+
+  while (true) {
+    if (curr_state == UnlockedState()) {
+      tail->next_ = nullptr;
+      if (state_.compare_exchange_weak(curr_state, head, std::memory_order::acquire, std::memory_order::relaxed)) {
+        Unlock();
+        return;
+      }
+    } else {
+      tail->next_ = static_cast<Awaiter*>(curr_state);
+      if (state_.compare_exchange_weak(curr_state, head, std::memory_order::release, std::memory_order::relaxed))
+        return;
+    }
+  }
+}
+
 void* Mutex::UnlockedState() const
 {
   return const_cast<Mutex*>(this);
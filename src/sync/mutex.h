@@ -4,7 +4,14 @@
 #pragma once
 
 #include "src/core/coroutine.h"
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <optional>
 #include <unifex/async_mutex.hpp>
+#include "src/core/cancel_token.h"
+#include "src/macro/macro.h"
+#include "./details/timed_wait.h"
 
 namespace aimrte::sync::v1
 {
@@ -38,11 +45,17 @@ class Mutex
     std::coroutine_handle<> continuation_;
     Awaiter* next_{nullptr};
 
+    // 限时或可取消的等待中，与超时计时、取消共享的状态，由它负责唤醒；无限期的等待中为空
+    details::TimedWait* timed_{nullptr};
+
     bool await_ready() const;
     bool await_suspend(std::coroutine_handle<> continuation);
     static constexpr void await_resume() {}
   };
 
+  // 限时或可取消的等待体
+  struct TimedAwaiter;
+
  public:
   Mutex();
 
@@ -61,6 +74,24 @@ class Mutex
    */
   co::Task<std::unique_lock<Mutex>> ScopedLock();
 
+  /**
+   * @brief 限时地加锁本互斥量。超时计时在当前执行器上进行，因此只能在执行器中使用；执行器启用了时间轮时，计时挂在时间轮上，加锁成功后即被撤销。
+   * @return 是否在超时之前加锁成功
+   */
+  co::Task<bool> TryLockFor(std::chrono::steady_clock::duration timeout, AIMRTE(src(loc)));
+
+  /**
+   * @brief 限时地加锁本互斥量，且可被取消令牌中止
+   * @return 是否在超时、取消之前加锁成功
+   */
+  co::Task<bool> TryLockFor(std::chrono::steady_clock::duration timeout, core::CancelToken token, AIMRTE(src(loc)));
+
+  /**
+   * @brief 加锁本互斥量，直到加锁成功，或取消令牌被取消
+   * @return 是否加锁成功
+   */
+  co::Task<bool> Lock(core::CancelToken token);
+
   /**
    * @brief 解锁本互斥量
    */
@@ -78,6 +109,31 @@ class Mutex
    */
   bool LockAndSuspend(Awaiter* awaiter);
 
+  /**
+   * @brief 限时或可取消的加锁的实现
+   */
+  co::Task<bool> LockWith(
+    std::optional<std::chrono::steady_clock::duration> timeout,
+    std::optional<core::CancelToken> token,
+    std::source_location loc);
+
+  /**
+   * @brief 唤醒给定的 awaiter ，并将锁交给它
+   * @return 是否成功；它已经超时或被取消时，返回 false ，锁仍由调用者持有
+   */
+  static bool Resume(Awaiter* awaiter);
+
+  /**
+   * @brief 限时或可取消的等待者放弃等待后调用，累计到一定数量时，压缩排队加锁的 LIFO 队列
+   */
+  void OnAbandoned();
+
+  /**
+   * @brief 取下 state_ 中排队的 awaiter ，释放其中已经超时或被取消的，再将其余的放回。
+   *        放回的 awaiter 排在压缩期间新到来的 awaiter 之后
+   */
+  void Compact();
+
   /**
    * @return 用于代表本互斥量未加锁的状态值，也即本互斥量的指针地址
    */
@@ -89,8 +145,19 @@ class Mutex
   // some awaiter: locked, some users are queued to lock.
   std::atomic<void*> state_;
 
-  // 等待被唤醒的 Awaiater 的 FIFO 队列。仅加锁的用户在 Unlock 时操作
+  // 等待被唤醒的 Awaiater 的 FIFO 队列。仅加锁的用户在 Unlock 时操作。
+  // 已经超时或被取消的 awaiter 不会立刻从队列中摘除，而是在轮到它时被跳过
   Awaiter* awaiter_{nullptr};
+
+  // 已经超时或被取消的 awaiter 累计到该数量时，压缩一次 state_ 中的队列，
+  // 使互斥量被长时间持有时，反复超时的 TryLockFor 不会让队列无限增长
+  static constexpr std::uint32_t kCompactThreshold = 64;
+
+  // 上一次压缩之后，放弃等待的 awaiter 的数量
+  std::atomic_uint32_t abandoned_{0};
+
+  // 是否有用户正在压缩队列，同一时间仅允许一个
+  std::atomic_bool compacting_{false};
 };
 }  // namespace aimrte::sync::v2
 
@@ -20,4 +20,102 @@ TEST_F(SyncTest, MutexMacro)
 {
   SyncMutexMacro<sync::Mutex>(*this);
 }
+
+TEST_F(SyncTest, MutexTryLockFor)
+{
+  sync::Mutex mutex;
+  std::atomic_int timeout = 0;
+  std::atomic_int locked  = 0;
+
+  GTEST_ASSERT_TRUE(mutex.TryLock());
+
+  exe.Post(
+    [&]() -> co::Task<void> {
+      if (not co_await mutex.TryLockFor(std::chrono::milliseconds(20)))
+        timeout.fetch_add(1);
+
+      // 超时的等待者不会影响排在后边的等待者
+      co_await mutex.Lock();
+      locked.fetch_add(1);
+      mutex.Unlock();
+    });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  GTEST_ASSERT_EQ(timeout.load(), 1);
+  GTEST_ASSERT_EQ(locked.load(), 0);
+
+  mutex.Unlock();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  GTEST_ASSERT_EQ(locked.load(), 1);
+  GTEST_ASSERT_TRUE(mutex.TryLock());
+  mutex.Unlock();
+}
+
+TEST_F(SyncTest, MutexTryLockForCompact)
+{
+  sync::Mutex mutex;
+  std::atomic_int timeout = 0;
+  std::atomic_int locked  = 0;
+
+  GTEST_ASSERT_TRUE(mutex.TryLock());
+
+  // 无限期的等待者排在反复超时的等待者之间，压缩队列时不能丢失它们
+  constexpr int kLockers  = 4;
+  constexpr int kTimeouts = 1000;
+
+  for (int i = 0; i < kTimeouts; ++i) {
+    if (i % (kTimeouts / kLockers) == 0) {
+      exe.Post(
+        [&]() -> co::Task<void> {
+          co_await mutex.Lock();
+          locked.fetch_add(1);
+          mutex.Unlock();
+        });
+    }
+
+    exe.Post(
+      [&]() -> co::Task<void> {
+        if (not co_await mutex.TryLockFor(std::chrono::milliseconds(1)))
+          timeout.fetch_add(1);
+      });
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(500));
+  GTEST_ASSERT_EQ(timeout.load(), kTimeouts);
+  GTEST_ASSERT_EQ(locked.load(), 0);
+
+  mutex.Unlock();
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  GTEST_ASSERT_EQ(locked.load(), kLockers);
+  GTEST_ASSERT_TRUE(mutex.TryLock());
+  mutex.Unlock();
+}
+
+TEST_F(SyncTest, MutexLockCancel)
+{
+  sync::Mutex mutex;
+  core::CancelToken token;
+  std::atomic_int cancelled = 0;
+
+  GTEST_ASSERT_TRUE(mutex.TryLock());
+
+  for (int i = 0; i < 10; ++i) {
+    exe.Post(
+      [&]() -> co::Task<void> {
+        if (not co_await mutex.Lock(token))
+          cancelled.fetch_add(1);
+      });
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  GTEST_ASSERT_EQ(cancelled.load(), 0);
+
+  token.Cancel();
+  GTEST_ASSERT_EQ(cancelled.load(), 10);
+
+  // 被取消的等待者全部被跳过，解锁后互斥量可以再次被加锁
+  mutex.Unlock();
+  GTEST_ASSERT_TRUE(mutex.TryLock());
+  mutex.Unlock();
+}
 }  // namespace aimrte::test
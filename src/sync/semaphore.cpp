@@ -0,0 +1,111 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./semaphore.h"
+#include <algorithm>
+#include "./details/cpu_relax.h"
+
+namespace aimrte::sync
+{
+bool Semaphore::Awaiter::await_ready() const
+{
+  // 先扣减许可，扣减之前仍有许可时，即获取成功；否则已登记为等待者，须入队挂起
+  return semaphore.count_.fetch_sub(1, std::memory_order::acq_rel) > 0;
+}
+
+void Semaphore::Awaiter::await_suspend(const std::coroutine_handle<> continuation)
+{
+  continuation_ = continuation;
+
+  // 压入 LIFO 链表，使用 release，与唤醒者取出链表形成 happen-before 关系。
+  // 入队之后，本协程随时可能被唤醒者恢复，不能再访问自身
+  Awaiter* head = semaphore.waiters_.load(std::memory_order::relaxed);
+  do {
+    next_ = head;
+  } while (not semaphore.waiters_.compare_exchange_weak(head, this, std::memory_order::release, std::memory_order::relaxed));
+}
+
+Semaphore::Semaphore(const std::int64_t initial)
+    : count_(initial)
+{
+}
+
+bool Semaphore::TryAcquire()
+{
+  std::int64_t curr = count_.load(std::memory_order::relaxed);
+
+  while (curr > 0) {
+    if (count_.compare_exchange_weak(curr, curr - 1, std::memory_order::acquire, std::memory_order::relaxed))
+      return true;
+  }
+
+  return false;
+}
+
+co::Task<void> Semaphore::Acquire()
+{
+  co_await Awaiter(*this);
+}
+
+void Semaphore::Release(const std::int64_t n)
+{
+  if (n <= 0)
+    return;
+
+  // 释放前的计数为负时，其中的等待者需要被唤醒
+  const std::int64_t old_count = count_.fetch_add(n, std::memory_order::acq_rel);
+  if (old_count < 0)
+    Wake(std::min(n, -old_count));
+}
+
+std::int64_t Semaphore::Available() const
+{
+  return std::max<std::int64_t>(count_.load(std::memory_order::relaxed), 0);
+}
+
+void Semaphore::Wake(const std::int64_t n)
+{
+  // 已有唤醒者时，仅登记唤醒次数，由它代为完成
+  if (wakeups_.fetch_add(n, std::memory_order::acq_rel) != 0)
+    return;
+
+  // 成为唤醒者，逐一唤醒，直到所有登记的唤醒都已完成。
+  // 被唤醒的协程可能在本线程上继续释放许可，此时仅登记次数，不会递归地唤醒
+  for (std::int64_t batch = n; batch > 0;) {
+    for (std::int64_t i = 0; i < batch; ++i)
+      PopWaiter()->continuation_.resume();
+
+    // 归还本批已经完成的唤醒次数，期间新登记的次数，作为下一批
+    batch = wakeups_.fetch_sub(batch, std::memory_order::acq_rel) - batch;
+  }
+}
+
+Semaphore::Awaiter* Semaphore::PopWaiter()
+{
+  while (fifo_ == nullptr) {
+    Awaiter* curr = waiters_.exchange(nullptr, std::memory_order::acquire);
+
+    // 等待者已扣减许可，但尚未入队
+    if (curr == nullptr) {
+      details::CpuRelax();
+      continue;
+    }
+
+    // 将 LIFO 链表翻转为 FIFO 队列
+    Awaiter* next = nullptr;
+    while (curr != nullptr) {
+      Awaiter* next_curr = curr->next_;
+      curr->next_        = next;
+
+      next = curr;
+      curr = next_curr;
+    }
+
+    fifo_ = next;
+  }
+
+  Awaiter* awaiter = fifo_;
+  fifo_            = awaiter->next_;
+  return awaiter;
+}
+}  // namespace aimrte::sync
@@ -0,0 +1,87 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <coroutine>
+#include <cstdint>
+#include "src/core/coroutine.h"
+
+namespace aimrte::sync
+{
+/**
+ * @brief 协程计数信号量。许可不足时，挂起协程排队等待，而不阻塞执行器线程。
+ *
+ * 许可计数使用单个原子变量（可为负，其绝对值即等待者的数量），无竞争时加锁与释放各仅一次原子操作。
+ * 等待者与 v2::Mutex 相同，以无锁的 LIFO 链表排队；释放许可时，由唯一的唤醒者将其翻转为 FIFO 队列，
+ * 并依次唤醒，并发的释放者仅登记唤醒次数，交由当前的唤醒者代为完成。
+ * 被唤醒的协程将在释放者的线程上继续执行。
+ */
+class Semaphore
+{
+  struct Awaiter {
+    Semaphore& semaphore;
+    std::coroutine_handle<> continuation_;
+    Awaiter* next_{nullptr};
+
+    bool await_ready() const;
+    void await_suspend(std::coroutine_handle<> continuation);
+    static constexpr void await_resume() {}
+  };
+
+ public:
+  /**
+   * @param initial 初始的许可数量
+   */
+  explicit Semaphore(std::int64_t initial = 0);
+
+  Semaphore(const Semaphore&)            = delete;
+  Semaphore& operator=(const Semaphore&) = delete;
+
+  /**
+   * @brief 尝试获取一个许可，返回成功与否
+   */
+  bool TryAcquire();
+
+  /**
+   * @brief 获取一个许可，许可不足时挂起等待
+   */
+  co::Task<void> Acquire();
+
+  /**
+   * @brief 释放给定数量的许可，并唤醒相应数量的等待者
+   */
+  void Release(std::int64_t n = 1);
+
+  /**
+   * @return 当前可用的许可数量，仅供参考
+   */
+  [[nodiscard]] std::int64_t Available() const;
+
+ private:
+  /**
+   * @brief 登记 n 次唤醒，若当前没有唤醒者，则由本线程成为唤醒者，完成所有登记的唤醒
+   */
+  void Wake(std::int64_t n);
+
+  /**
+   * @brief 取出最早排队的等待者，仅由唤醒者调用。
+   *        等待者可能已经扣减了许可、但尚未入队，此时短暂自旋等待其入队。
+   */
+  Awaiter* PopWaiter();
+
+ private:
+  // 可用的许可数量，为负时表示等待者的数量
+  std::atomic_int64_t count_;
+
+  // 排队等待的 Awaiter 的 LIFO 链表，由等待者并发压入
+  std::atomic<Awaiter*> waiters_{nullptr};
+
+  // 已翻转为 FIFO 的等待者队列，仅由唤醒者访问
+  Awaiter* fifo_{nullptr};
+
+  // 尚未完成的唤醒次数，不为 0 时表示存在唤醒者
+  std::atomic_int64_t wakeups_{0};
+};
+}  // namespace aimrte::sync
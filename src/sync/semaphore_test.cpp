@@ -0,0 +1,78 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./test/common.h"
+#include "src/sync/sync.h"
+
+namespace aimrte::test
+{
+TEST_F(SyncTest, SemaphoreTryAcquire)
+{
+  sync::Semaphore sem(2);
+
+  GTEST_ASSERT_TRUE(sem.TryAcquire());
+  GTEST_ASSERT_TRUE(sem.TryAcquire());
+  GTEST_ASSERT_FALSE(sem.TryAcquire());
+  GTEST_ASSERT_EQ(sem.Available(), 0);
+
+  sem.Release(2);
+  GTEST_ASSERT_EQ(sem.Available(), 2);
+}
+
+TEST_F(SyncTest, SemaphoreLimitsConcurrency)
+{
+  constexpr int kPermits = 3;
+  sync::Semaphore sem(kPermits);
+
+  std::atomic_int inside     = 0;
+  std::atomic_int max_inside = 0;
+  std::atomic_int done       = 0;
+
+  for (int i = 0; i < 1000; ++i) {
+    exe.Post(
+      [&]() -> co::Task<void> {
+        co_await sem.Acquire();
+
+        const int curr = inside.fetch_add(1) + 1;
+        for (int prev = max_inside.load(); curr > prev and not max_inside.compare_exchange_weak(prev, curr);) {
+        }
+
+        co_await ctx::Yield();
+
+        inside.fetch_sub(1);
+        sem.Release();
+        done.fetch_add(1);
+      });
+  }
+
+  // 让所有协程执行完毕
+  ctrl.LetEnd();
+  GTEST_ASSERT_EQ(done.load(), 1000);
+  GTEST_ASSERT_LE(max_inside.load(), kPermits);
+  GTEST_ASSERT_EQ(sem.Available(), kPermits);
+}
+
+TEST_F(SyncTest, SemaphoreReleaseWakesWaiters)
+{
+  sync::Semaphore sem(0);
+  std::atomic_int acquired = 0;
+
+  for (int i = 0; i < 5; ++i) {
+    exe.Post(
+      [&]() -> co::Task<void> {
+        co_await sem.Acquire();
+        acquired.fetch_add(1);
+      });
+  }
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(50));
+  GTEST_ASSERT_EQ(acquired.load(), 0);
+
+  // 一次释放多个许可，唤醒相应数量的等待者
+  sem.Release(3);
+  GTEST_ASSERT_EQ(acquired.load(), 3);
+
+  sem.Release(2);
+  GTEST_ASSERT_EQ(acquired.load(), 5);
+}
+}  // namespace aimrte::test
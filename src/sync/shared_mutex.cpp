@@ -0,0 +1,84 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./shared_mutex.h"
+
+namespace aimrte::sync
+{
+bool SharedMutex::TryLock()
+{
+  if (not writer_mutex_.TryLock())
+    return false;
+
+  // 仅在没有任何读者时加锁成功
+  std::int64_t expected = 0;
+  if (not reader_count_.compare_exchange_strong(expected, -kMaxReaders, std::memory_order::acquire, std::memory_order::relaxed)) {
+    writer_mutex_.Unlock();
+    return false;
+  }
+
+  return true;
+}
+
+co::Task<void> SharedMutex::Lock()
+{
+  // 先与其他写者互斥
+  co_await writer_mutex_.Lock();
+
+  // 宣告写者的到来，此后新的读者将排队等待
+  const std::int64_t readers = reader_count_.fetch_sub(kMaxReaders, std::memory_order::acq_rel);
+
+  // 等待已持有锁的读者全部离开
+  if (readers != 0 and reader_wait_.fetch_add(readers, std::memory_order::acq_rel) + readers != 0)
+    co_await writer_sem_.Acquire();
+}
+
+co::Task<std::unique_lock<SharedMutex>> SharedMutex::ScopedLock()
+{
+  co_await Lock();
+  co_return std::unique_lock(*this, std::adopt_lock);
+}
+
+void SharedMutex::Unlock()
+{
+  // 宣告写者的离开，并放行在此期间排队的读者
+  const std::int64_t readers = reader_count_.fetch_add(kMaxReaders, std::memory_order::acq_rel) + kMaxReaders;
+  reader_sem_.Release(readers);
+
+  writer_mutex_.Unlock();
+}
+
+bool SharedMutex::TryLockShared()
+{
+  std::int64_t curr = reader_count_.load(std::memory_order::relaxed);
+
+  while (curr >= 0) {
+    if (reader_count_.compare_exchange_weak(curr, curr + 1, std::memory_order::acquire, std::memory_order::relaxed))
+      return true;
+  }
+
+  return false;
+}
+
+co::Task<void> SharedMutex::LockShared()
+{
+  // 有写者持有或等待写锁时，排队等待其离开
+  if (reader_count_.fetch_add(1, std::memory_order::acq_rel) < 0)
+    co_await reader_sem_.Acquire();
+}
+
+co::Task<std::shared_lock<SharedMutex>> SharedMutex::ScopedLockShared()
+{
+  co_await LockShared();
+  co_return std::shared_lock(*this, std::adopt_lock);
+}
+
+void SharedMutex::UnlockShared()
+{
+  // 有写者等待时，最后一个离开的读者唤醒它
+  if (reader_count_.fetch_sub(1, std::memory_order::acq_rel) - 1 < 0) {
+    if (reader_wait_.fetch_sub(1, std::memory_order::acq_rel) - 1 == 0)
+      writer_sem_.Release();
+  }
+}
+}  // namespace aimrte::sync
@@ -0,0 +1,96 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <mutex>
+#include <shared_mutex>
+#include "src/core/coroutine.h"
+#include "./mutex.h"
+#include "./semaphore.h"
+
+namespace aimrte::sync
+{
+/**
+ * @brief 协程读写锁，加锁失败时挂起协程，而不阻塞执行器线程。
+ *
+ * 读者计数使用单个原子变量，无写者时，读者加锁与解锁各仅一次原子操作；
+ * 写者之间由 v2::Mutex 互斥，并通过将读者计数减去 kMaxReaders 来宣告自己的到来，
+ * 此后新到来的读者在信号量上排队，写者等待已持有锁的读者离开后进入（写者优先，避免写者饥饿）。
+ * 写者解锁时，一次性放行所有排队的读者。
+ */
+class SharedMutex
+{
+ public:
+  // 同时持有读锁的读者数量上限
+  static constexpr std::int64_t kMaxReaders = std::int64_t{1} << 30;
+
+  SharedMutex() = default;
+
+  SharedMutex(const SharedMutex&)            = delete;
+  SharedMutex& operator=(const SharedMutex&) = delete;
+
+  /**
+   * @brief 尝试加写锁，返回成功与否
+   */
+  bool TryLock();
+
+  /**
+   * @brief 加写锁
+   */
+  co::Task<void> Lock();
+
+  /**
+   * @brief 加写锁，并返回一个自动解锁的对象
+   */
+  co::Task<std::unique_lock<SharedMutex>> ScopedLock();
+
+  /**
+   * @brief 解写锁
+   */
+  void Unlock();
+
+  /**
+   * @brief 尝试加读锁，返回成功与否
+   */
+  bool TryLockShared();
+
+  /**
+   * @brief 加读锁
+   */
+  co::Task<void> LockShared();
+
+  /**
+   * @brief 加读锁，并返回一个自动解锁的对象
+   */
+  co::Task<std::shared_lock<SharedMutex>> ScopedLockShared();
+
+  /**
+   * @brief 解读锁
+   */
+  void UnlockShared();
+
+ public:
+  // 为 std::unique_lock 与 std::shared_lock 提供接口
+  void lock() { Lock().Sync(); }
+  void unlock() { Unlock(); }
+  void lock_shared() { LockShared().Sync(); }
+  void unlock_shared() { UnlockShared(); }
+
+ private:
+  // 写者之间的互斥
+  v2::Mutex writer_mutex_;
+
+  // 等待读者离开的写者，与等待写者离开的读者
+  Semaphore writer_sem_{0};
+  Semaphore reader_sem_{0};
+
+  // 持有或等待读锁的读者数量，有写者时为负（减去了 kMaxReaders）
+  std::atomic_int64_t reader_count_{0};
+
+  // 写者到来时，尚未离开的读者数量
+  std::atomic_int64_t reader_wait_{0};
+};
+}  // namespace aimrte::sync
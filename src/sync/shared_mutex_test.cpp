@@ -0,0 +1,85 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "./test/common.h"
+#include "src/sync/sync.h"
+
+namespace aimrte::test
+{
+TEST_F(SyncTest, SharedMutexBasicUsage)
+{
+  SyncMutexBasicUsage<sync::SharedMutex>(*this);
+}
+
+TEST_F(SyncTest, SharedMutexLotsOfParallel)
+{
+  SyncMutexLotsOfParallel<sync::SharedMutex>(*this);
+}
+
+TEST_F(SyncTest, SharedMutexMacro)
+{
+  SyncMutexMacro<sync::SharedMutex>(*this);
+}
+
+TEST_F(SyncTest, SharedMutexTryLock)
+{
+  sync::SharedMutex mutex;
+
+  GTEST_ASSERT_TRUE(mutex.TryLockShared());
+  GTEST_ASSERT_TRUE(mutex.TryLockShared());
+  GTEST_ASSERT_FALSE(mutex.TryLock());
+  mutex.UnlockShared();
+  mutex.UnlockShared();
+
+  GTEST_ASSERT_TRUE(mutex.TryLock());
+  GTEST_ASSERT_FALSE(mutex.TryLockShared());
+  GTEST_ASSERT_FALSE(mutex.TryLock());
+  mutex.Unlock();
+
+  GTEST_ASSERT_TRUE(mutex.TryLockShared());
+  mutex.UnlockShared();
+}
+
+TEST_F(SyncTest, SharedMutexReadersAndWriters)
+{
+  sync::SharedMutex mutex;
+
+  // 读者之间可以并发，但不能与写者并发
+  std::atomic_int readers     = 0;
+  std::atomic_int max_readers = 0;
+  bool conflict               = false;
+  int value                   = 0;
+
+  for (int i = 0; i < 1000; ++i) {
+    if (i % 10 == 0) {
+      exe.Post(
+        [&]() -> co::Task<void> {
+          std::unique_lock lock = co_await mutex.ScopedLock();
+
+          if (readers.load() != 0)
+            conflict = true;
+
+          ++value;
+        });
+    } else {
+      exe.Post(
+        [&]() -> co::Task<void> {
+          std::shared_lock lock = co_await mutex.ScopedLockShared();
+
+          const int curr = readers.fetch_add(1) + 1;
+          for (int prev = max_readers.load(); curr > prev and not max_readers.compare_exchange_weak(prev, curr);) {
+          }
+
+          co_await ctx::Yield();
+          readers.fetch_sub(1);
+        });
+    }
+  }
+
+  // 让所有协程执行完毕
+  ctrl.LetEnd();
+  GTEST_ASSERT_FALSE(conflict);
+  GTEST_ASSERT_EQ(value, 100);
+  GTEST_ASSERT_EQ(readers.load(), 0);
+}
+}  // namespace aimrte::test
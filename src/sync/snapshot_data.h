@@ -0,0 +1,136 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <memory>
+
+namespace aimrte::sync
+{
+/**
+ * @brief 以快照形式共享的最新数据，适用于被多个线程高频读取的较大的数据。
+ *
+ * 每次写入都会生成一份新的不可变快照，并原子地替换旧的快照；读者仅原子地取得当前快照的引用，
+ * 不复制数据，旧的快照在最后一个读者释放后自动回收（类似 RCU）。
+ * 注意它并非无锁的：libstdc++ 的 std::atomic<std::shared_ptr> 以指针中的锁位保护引用计数的增减，
+ * 读者与写者会在替换或取得引用的瞬间互相阻塞，但锁内仅有几条指令，数据的构造与复制都在锁外进行。
+ * 超时判断使用 steady_clock ，且仅在设置了超时时间时才读取时钟。
+ */
+template <class T>
+class SnapshotData
+{
+ public:
+  /**
+   * @brief 构造函数
+   * @param timeout 数据的超时时间，默认为 0 ，表示不设置超时。超过该时间仍未写入新的数据时，视为无数据
+   */
+  explicit SnapshotData(std::chrono::steady_clock::duration timeout = {}) : timeout_(timeout)
+  {
+  }
+
+  /**
+   * @brief 写入数据，生成新的快照
+   * @param a 要设置的值
+   */
+  void Set(T a)
+  {
+    Store(std::make_shared<const Node>(std::move(a), StampNow()));
+  }
+
+  /**
+   * @brief 写入数据，生成新的快照
+   * @param args 用于原地构造数据的参数
+   */
+  template <class... Args>
+  void Emplace(Args&&... args)
+  {
+    Store(std::make_shared<const Node>(T(std::forward<Args>(args)...), StampNow()));
+  }
+
+  /**
+   * @return 当前数据的快照，无数据或已超时时返回空指针
+   */
+  std::shared_ptr<const T> Get() const
+  {
+    return Visible(node_.load(std::memory_order_acquire));
+  }
+
+  /**
+   * @brief 读取当前数据的副本
+   * @param a 获取到的值
+   * @return 是否获取成功(无值，或超时时返回false)
+   */
+  bool Get(T& a) const
+  {
+    const std::shared_ptr<const T> snapshot = Get();
+    if (snapshot == nullptr)
+      return false;
+
+    a = *snapshot;
+    return true;
+  }
+
+  /**
+   * @brief 取走当前数据的快照，并清空数据
+   * @return 取走的快照，无数据或已超时时返回空指针
+   */
+  std::shared_ptr<const T> GetAndClear()
+  {
+    return Visible(node_.exchange(nullptr, std::memory_order_acq_rel));
+  }
+
+  /**
+   * @return 是否有值（无值或超时时返回false）
+   */
+  bool Has() const
+  {
+    return Get() != nullptr;
+  }
+
+  /**
+   * @brief 清空数据
+   */
+  void Clear()
+  {
+    node_.store(nullptr, std::memory_order_release);
+  }
+
+ private:
+  // 一份不可变的快照，与其写入时间
+  struct Node {
+    T value;
+    std::chrono::steady_clock::time_point stamp;
+  };
+
+  std::chrono::steady_clock::time_point StampNow() const
+  {
+    return timeout_ == std::chrono::steady_clock::duration{} ? std::chrono::steady_clock::time_point{} : std::chrono::steady_clock::now();
+  }
+
+  void Store(std::shared_ptr<const Node> node)
+  {
+    node_.store(std::move(node), std::memory_order_release);
+  }
+
+  std::shared_ptr<const T> Visible(std::shared_ptr<const Node> node) const
+  {
+    if (node == nullptr)
+      return nullptr;
+
+    if (timeout_ != std::chrono::steady_clock::duration{} and std::chrono::steady_clock::now() - node->stamp > timeout_)
+      return nullptr;
+
+    // 与快照共享所有权，仅指向其中的数据
+    const T* value = &node->value;
+    return {std::move(node), value};
+  }
+
+ private:
+  const std::chrono::steady_clock::duration timeout_;
+
+  // 当前的快照。读写都会短暂地持有其内部的锁位，仅用于交换指针与增加引用计数
+  std::atomic<std::shared_ptr<const Node>> node_;
+};
+}  // namespace aimrte::sync
@@ -0,0 +1,99 @@
+// Copyright (c) 2025, AgiBot Inc.
+// All rights reserved.
+
+#include "src/sync/sync.h"
+#include "src/test/test.h"
+
+namespace aimrte::test
+{
+TEST(SnapshotDataTest, SetAndGet)
+{
+  sync::SnapshotData<std::vector<int>> data;
+  EXPECT_FALSE(data.Has());
+  EXPECT_EQ(data.Get(), nullptr);
+
+  data.Set({1, 2, 3});
+  const std::shared_ptr<const std::vector<int>> snapshot = data.Get();
+  ASSERT_NE(snapshot, nullptr);
+  EXPECT_EQ(*snapshot, std::vector<int>({1, 2, 3}));
+
+  // 新的写入不影响已经取得的快照
+  data.Emplace(5, 0);
+  EXPECT_EQ(snapshot->size(), 3);
+  EXPECT_EQ(data.Get()->size(), 5);
+
+  std::vector<int> copy;
+  EXPECT_TRUE(data.Get(copy));
+  EXPECT_EQ(copy.size(), 5);
+}
+
+TEST(SnapshotDataTest, GetAndClear)
+{
+  sync::SnapshotData<int> data;
+  data.Set(1);
+
+  const std::shared_ptr<const int> value = data.GetAndClear();
+  ASSERT_NE(value, nullptr);
+  EXPECT_EQ(*value, 1);
+  EXPECT_FALSE(data.Has());
+  EXPECT_EQ(data.GetAndClear(), nullptr);
+
+  data.Set(2);
+  data.Clear();
+  EXPECT_FALSE(data.Has());
+}
+
+TEST(SnapshotDataTest, Timeout)
+{
+  sync::SnapshotData<int> data(std::chrono::milliseconds(10));
+  data.Set(100);
+  EXPECT_TRUE(data.Has());
+
+  std::this_thread::sleep_for(std::chrono::milliseconds(20));
+  EXPECT_FALSE(data.Has());
+
+  int value = 0;
+  EXPECT_FALSE(data.Get(value));
+
+  data.Set(101);
+  EXPECT_TRUE(data.Get(value));
+  EXPECT_EQ(value, 101);
+}
+
+TEST(SnapshotDataTest, ConcurrentReadWrite)
+{
+  // 写者总是写入首尾一致的数组，读者不应看到被撕裂的数据
+  struct State {
+    std::array<std::uint64_t, 64> values{};
+  };
+
+  sync::SnapshotData<State> data;
+  std::atomic_bool running = true;
+  std::atomic_int torn     = 0;
+
+  std::vector<std::thread> readers;
+  for (int i = 0; i < 4; ++i) {
+    readers.emplace_back(
+      [&]() {
+        while (running.load()) {
+          const std::shared_ptr<const State> state = data.Get();
+          if (state != nullptr and state->values.front() != state->values.back())
+            torn.fetch_add(1);
+        }
+      });
+  }
+
+  for (std::uint64_t n = 0; n < 100000; ++n) {
+    State state;
+    state.values.fill(n);
+    data.Set(state);
+  }
+
+  running = false;
+  for (std::thread& reader : readers)
+    reader.join();
+
+  EXPECT_EQ(torn.load(), 0);
+  EXPECT_EQ(data.Get()->values.front(), 99999);
+}
+}  // namespace aimrte::test
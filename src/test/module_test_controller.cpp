@@ -2,6 +2,8 @@
 // All rights reserved.
 
 #include "./module_test_controller.h"
+#include "src/runtime/executor/priority_executor.h"
+#include "src/runtime/executor/work_stealing_executor.h"
 #include <fmt/format.h>
 #include <fstream>
 
@@ -26,6 +28,13 @@ namespace aimrte::test
 ModuleTestController::ModuleTestController()
     : module_(this)
 {
+  // 注册 aimrte 提供的执行器类型
+  core_.RegisterHookFunc(
+    aimrt::runtime::core::AimRTCore::State::kPreInitExecutor,
+    [this]() {
+      runtime::executor::WorkStealingExecutor::Register(core_.GetExecutorManager());
+      runtime::executor::PriorityExecutor::Register(core_.GetExecutorManager());
+    });
 }
 
 void ModuleTestController::SetConfigContent(std::string cfg_content)
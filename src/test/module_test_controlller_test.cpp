@@ -64,6 +64,16 @@ TEST_F(ModuleTestControllerTest, Run)
   GTEST_ASSERT_EQ(uint32_t(ctrl.GetCore().GetState()), uint32_t(aimrte::runtime::State::kPostStart));
 }
 
+TEST_F(ModuleTestControllerTest, ContextAfterRun)
+{
+  ctrl.SetConfigContent(cfg);
+  ctrl.LetRun();
+
+  // 推进各个阶段时，被释放的模块线程不应改写测试线程的上下文
+  GTEST_ASSERT_NE(core::details::g_thread_ctx->ctx_ptr.lock(), nullptr);
+  ctx::log().Info("context is still available after LetRun()");
+}
+
 TEST_F(ModuleTestControllerTest, Shutdown)
 {
   ctrl.SetConfigContent(cfg);